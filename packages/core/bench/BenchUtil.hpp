@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <time.h>
+
+namespace nitroperf::bench {
+
+/** CPU time consumed by the calling thread, in ns. */
+inline int64_t threadCpuNs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+/**
+ * Calling-thread CPU ns per iteration of `body(i)` over `iterations`
+ * runs. CPU rather than wall time, so other threads sharing the core
+ * (readers, writers) don't count against the measured path, while the
+ * cache-line traffic they cause does.
+ */
+template <typename Fn>
+double cpuNsPerIteration(uint64_t iterations, Fn&& body) {
+  int64_t start = threadCpuNs();
+  for (uint64_t i = 0; i < iterations; i++) {
+    body(i);
+  }
+  return static_cast<double>(threadCpuNs() - start) / static_cast<double>(iterations);
+}
+
+} // namespace nitroperf::bench
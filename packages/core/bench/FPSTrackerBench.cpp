@@ -0,0 +1,50 @@
+// Per-tick cost of FPSTracker::onFrameTick() on the producer thread, alone
+// and with reader threads hammering getSamples() / getMinFps() the way the
+// timer and JS threads do.
+
+#include "BenchUtil.hpp"
+#include "FPSTracker.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using nitroperf::FPSTracker;
+
+static constexpr uint64_t kTicks = 5'000'000;
+static constexpr size_t kHistorySamples = 600;
+
+static double measure(int readers) {
+  FPSTracker tracker(kHistorySamples);
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> reads{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < readers; i++) {
+    threads.emplace_back([&] {
+      uint64_t local = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        auto samples = tracker.getSamples();
+        local += samples.size() + static_cast<uint64_t>(tracker.getMinFps() >= 0);
+      }
+      reads.fetch_add(local, std::memory_order_relaxed);
+    });
+  }
+
+  double ns = nitroperf::bench::cpuNsPerIteration(kTicks, [&](uint64_t i) {
+    tracker.onFrameTick(static_cast<double>(i) / 60.0);
+  });
+
+  stop.store(true);
+  for (auto& thread : threads) thread.join();
+  return ns;
+}
+
+int main() {
+  std::printf("FPSTracker::onFrameTick, %llu ticks, %zu-sample history\n",
+              static_cast<unsigned long long>(kTicks), kHistorySamples);
+  for (int readers : {0, 1, 3}) {
+    std::printf("  %d reader thread(s): %6.1f ns/tick (producer CPU)\n", readers, measure(readers));
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+// Native cost of JS frame ingestion: one FPSTracker::onFrameTick() per
+// frame, as reportJsFrameTick() does, against onFrameTicks() over the
+// batches reportJsFrameTicks() receives (16 per flush from singleton.ts).
+// Both paths see the same millisecond timestamps and must end with the
+// same stats. The JSI crossing the batching saves on top of this is not
+// modeled here; measure that on device under Hermes.
+
+#include "BenchUtil.hpp"
+#include "FPSTracker.hpp"
+
+#include <cstdio>
+#include <vector>
+
+using nitroperf::FPSTracker;
+
+static constexpr uint64_t kTicks = 4'800'000; // a multiple of every batch size
+static constexpr size_t kHistorySamples = 600;
+static constexpr double kJsOffsetMs = 1234.5;
+
+// performance.now() of frame i: 60 Hz with two skipped vsyncs every 97th
+// frame, so the drop and episode paths run as well
+struct FrameClock {
+  double ms = 0.0;
+  uint64_t frame = 0;
+  double next() {
+    ms += (frame++ % 97 == 96 ? 3.0 : 1.0) * (1000.0 / 60.0);
+    return ms;
+  }
+};
+
+struct Result {
+  double nsPerTick;
+  FPSTracker::Stats stats;
+  uint64_t frameTimeCount;
+};
+
+static Result perFrame() {
+  FPSTracker tracker(kHistorySamples);
+  FrameClock clock;
+  double ns = nitroperf::bench::cpuNsPerIteration(kTicks, [&](uint64_t) {
+    tracker.onFrameTick((clock.next() + kJsOffsetMs) / 1000.0);
+  });
+  return {ns, tracker.getStats(), tracker.getFrameTimeHistogram().count};
+}
+
+static Result batched(size_t batchSize) {
+  FPSTracker tracker(kHistorySamples);
+  FrameClock clock;
+  std::vector<double> batch(batchSize);
+  double ns = nitroperf::bench::cpuNsPerIteration(kTicks / batchSize, [&](uint64_t) {
+    for (double& timestamp : batch) timestamp = clock.next();
+    tracker.onFrameTicks(batch.data(), batch.size(), 1.0 / 1000.0, kJsOffsetMs / 1000.0);
+  });
+  return {ns / static_cast<double>(batchSize), tracker.getStats(), tracker.getFrameTimeHistogram().count};
+}
+
+static bool sameResults(const Result& a, const Result& b) {
+  return a.stats.currentFps == b.stats.currentFps && a.stats.minFps == b.stats.minFps &&
+         a.stats.droppedFrames == b.stats.droppedFrames && a.stats.stutterCount == b.stats.stutterCount &&
+         a.stats.refreshRateHz == b.stats.refreshRateHz && a.frameTimeCount == b.frameTimeCount;
+}
+
+int main() {
+  std::printf("JS frame ingestion, %llu ticks, %zu-sample history\n",
+              static_cast<unsigned long long>(kTicks), kHistorySamples);
+  Result single = perFrame();
+  std::printf("  per-frame onFrameTick:     %6.1f ns/tick\n", single.nsPerTick);
+
+  bool identical = true;
+  for (size_t batchSize : {1, 4, 16, 64}) {
+    Result result = batched(batchSize);
+    bool same = sameResults(single, result);
+    identical = identical && same;
+    std::printf("  onFrameTicks, batch of %2zu: %6.1f ns/tick%s\n", batchSize, result.nsPerTick,
+                same ? "" : "  (stats differ!)");
+  }
+  return identical ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+// Cost of one RSS sample on Linux: the ifstream + getline scan of
+// /proc/self/status that Android used to run on every snapshot, against
+// StatmSampler's pread() of /proc/self/statm on a descriptor kept open.
+// Heap allocations are counted by replacing operator new.
+
+#include "BenchUtil.hpp"
+#include "ProcFile.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+static std::atomic<uint64_t> gAllocations{0};
+
+void* operator new(size_t size) {
+  gAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+static constexpr uint64_t kSamples = 100'000;
+
+/** The previous implementation: VmRSS from /proc/self/status, in bytes. */
+static int64_t statusResidentBytes() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) {
+      return std::strtoll(line.c_str() + 6, nullptr, 10) * 1024;
+    }
+  }
+  return 0;
+}
+
+template <typename Fn>
+static void report(const char* name, Fn&& sample) {
+  int64_t sink = 0;
+  uint64_t before = gAllocations.load();
+  double ns = nitroperf::bench::cpuNsPerIteration(kSamples, [&](uint64_t) { sink += sample(); });
+  double allocations = static_cast<double>(gAllocations.load() - before) / static_cast<double>(kSamples);
+  std::printf("  %-36s %7.2f us/sample  %4.1f allocs/sample\n", name, ns / 1000.0, allocations);
+  if (sink == 0) std::printf("  (no value read)\n");
+}
+
+int main() {
+  nitroperf::StatmSampler statm;
+  std::printf("RSS sampling, %llu samples (sampling thread CPU)\n", static_cast<unsigned long long>(kSamples));
+  report("ifstream + getline /proc/self/status", statusResidentBytes);
+  report("persistent fd + pread statm", [&] { return statm.residentBytes(); });
+  std::printf("  VmRSS %lld KB, statm %lld KB\n", static_cast<long long>(statusResidentBytes() / 1024),
+              static_cast<long long>(statm.residentBytes() / 1024));
+  return 0;
+}
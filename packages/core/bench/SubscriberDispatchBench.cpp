@@ -0,0 +1,134 @@
+// Cost of one subscriber dispatch on the timer thread: the copy-on-write
+// list HybridPerfMonitor uses against the mutex + map it replaced, with
+// 1, 10 and 100 subscribers while another thread keeps subscribing and
+// unsubscribing. Then the point of the change: how long subscribe() waits
+// while a dispatch with a slow (1 ms) callback is in flight.
+
+#include "BenchUtil.hpp"
+#include "CopyOnWriteList.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+static constexpr uint64_t kDispatches = 200'000;
+
+struct Subscriber {
+  uint64_t id;
+  std::function<void(uint64_t)> callback;
+};
+
+static std::atomic<uint64_t> gSink{0};
+
+static std::function<void(uint64_t)> makeCallback() {
+  return [](uint64_t value) { gSink.fetch_add(value, std::memory_order_relaxed); };
+}
+
+static double copyOnWrite(size_t subscribers) {
+  nitroperf::CopyOnWriteList<Subscriber> list;
+  for (size_t i = 0; i < subscribers; i++) {
+    list.update([&](auto& items) { items.push_back(Subscriber{i, makeCallback()}); });
+  }
+
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    for (uint64_t id = 1'000'000; !stop.load(std::memory_order_relaxed); id++) {
+      list.update([&](auto& items) { items.push_back(Subscriber{id, makeCallback()}); });
+      list.update([&](auto& items) { items.pop_back(); });
+    }
+  });
+
+  double ns = nitroperf::bench::cpuNsPerIteration(kDispatches, [&](uint64_t i) {
+    list.forEach([&](const Subscriber& subscriber) { subscriber.callback(i); });
+  });
+  stop.store(true);
+  writer.join();
+  return ns;
+}
+
+static double mutexMap(size_t subscribers) {
+  std::mutex mutex;
+  std::unordered_map<uint64_t, std::function<void(uint64_t)>> map;
+  for (size_t i = 0; i < subscribers; i++) {
+    map.emplace(i, makeCallback());
+  }
+
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    for (uint64_t id = 1'000'000; !stop.load(std::memory_order_relaxed); id++) {
+      { std::lock_guard<std::mutex> lock(mutex); map.emplace(id, makeCallback()); }
+      { std::lock_guard<std::mutex> lock(mutex); map.erase(id); }
+    }
+  });
+
+  double ns = nitroperf::bench::cpuNsPerIteration(kDispatches, [&](uint64_t i) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [id, callback] : map) callback(i);
+  });
+  stop.store(true);
+  writer.join();
+  return ns;
+}
+
+/** Worst wall-clock subscribe() latency, in µs, over `writes` writes. */
+template <typename Dispatch, typename Subscribe>
+static double worstSubscribeUs(Dispatch&& dispatch, Subscribe&& subscribe, int writes) {
+  std::atomic<bool> stop{false};
+  std::thread dispatcher([&] {
+    while (!stop.load(std::memory_order_relaxed)) dispatch();
+  });
+  double worst = 0.0;
+  for (int i = 0; i < writes; i++) {
+    auto start = std::chrono::steady_clock::now();
+    subscribe(static_cast<uint64_t>(i));
+    worst = std::max(worst, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    std::this_thread::sleep_for(std::chrono::microseconds(300));
+  }
+  stop.store(true);
+  dispatcher.join();
+  return worst;
+}
+
+static void slowCallback() {
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+int main() {
+  std::printf("Subscriber dispatch, %llu dispatches, writer churning (dispatcher CPU ns/dispatch)\n",
+              static_cast<unsigned long long>(kDispatches));
+  std::printf("  subscribers  copy-on-write  mutex + map\n");
+  for (size_t subscribers : {1, 10, 100}) {
+    std::printf("  %11zu  %13.1f  %11.1f\n", subscribers, copyOnWrite(subscribers), mutexMap(subscribers));
+  }
+
+  constexpr int kWrites = 200;
+  nitroperf::CopyOnWriteList<Subscriber> list;
+  list.update([](auto& items) { items.push_back(Subscriber{0, [](uint64_t) { slowCallback(); }}); });
+  double copyOnWriteUs = worstSubscribeUs(
+    [&] { list.forEach([](const Subscriber& subscriber) { subscriber.callback(0); }); },
+    [&](uint64_t id) { list.update([&](auto& items) { items.push_back(Subscriber{id + 1, makeCallback()}); }); },
+    kWrites);
+
+  std::mutex mutex;
+  std::unordered_map<uint64_t, std::function<void(uint64_t)>> map;
+  map.emplace(0, [](uint64_t) { slowCallback(); });
+  double mutexUs = worstSubscribeUs(
+    [&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto& [id, callback] : map) callback(0);
+    },
+    [&](uint64_t id) {
+      std::lock_guard<std::mutex> lock(mutex);
+      map.emplace(id + 1, makeCallback());
+    },
+    kWrites);
+
+  std::printf("Worst subscribe() latency during a 1 ms callback, %d subscribes\n", kWrites);
+  std::printf("  copy-on-write %8.1f us\n  mutex + map   %8.1f us\n", copyOnWriteUs, mutexUs);
+  return 0;
+}
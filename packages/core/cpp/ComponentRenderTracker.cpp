@@ -0,0 +1,117 @@
+#include "ComponentRenderTracker.hpp"
+#include <algorithm>
+
+namespace nitroperf {
+
+ComponentRenderTracker::ComponentRenderTracker(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)) {
+  heap_.reserve(capacity_);
+  names_.emplace_back(kOverflowName);
+  slotById_.push_back(kNoSlot);
+}
+
+uint32_t ComponentRenderTracker::intern(std::string_view name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::string key(name);
+  auto it = idsByName_.find(key);
+  if (it != idsByName_.end()) return it->second;
+  if (names_.size() > kMaxComponents) return 0; // id 0 is the overflow bucket
+
+  uint32_t id = static_cast<uint32_t>(names_.size());
+  names_.push_back(key);
+  slotById_.push_back(kNoSlot);
+  idsByName_.emplace(std::move(key), id);
+  return id;
+}
+
+void ComponentRenderTracker::record(uint32_t componentId, Phase phase, double durationMs) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (componentId >= slotById_.size() || phase > kNestedUpdate) return;
+
+  int32_t slot = slotById_[componentId];
+  if (slot == kNoSlot) {
+    if (heap_.size() < capacity_) {
+      slot = static_cast<int32_t>(heap_.size());
+      heap_.push_back(Counter{componentId, 0, 0, 0.0, 0.0, 0.0, {0, 0, 0}});
+    } else {
+      // Space-Saving: evict the least counted component; the newcomer
+      // inherits its count as the error bound
+      slot = 0;
+      Counter& evicted = heap_[0];
+      slotById_[evicted.componentId] = kNoSlot;
+      evicted = Counter{componentId, evicted.count, evicted.count, 0.0, 0.0, 0.0, {0, 0, 0}};
+    }
+    slotById_[componentId] = slot;
+  }
+
+  Counter& counter = heap_[static_cast<size_t>(slot)];
+  counter.count++;
+  counter.totalDurationMs += durationMs;
+  counter.maxDurationMs = std::max(counter.maxDurationMs, durationMs);
+  counter.lastDurationMs = durationMs;
+  counter.phaseCounts[phase]++;
+
+  // Counts only grow, so the counter can only move away from the root
+  siftDown(static_cast<size_t>(slot));
+}
+
+void ComponentRenderTracker::siftDown(size_t index) {
+  while (true) {
+    size_t smallest = index;
+    size_t left = 2 * index + 1;
+    size_t right = left + 1;
+    if (left < heap_.size() && heap_[left].count < heap_[smallest].count) smallest = left;
+    if (right < heap_.size() && heap_[right].count < heap_[smallest].count) smallest = right;
+    if (smallest == index) break;
+    std::swap(heap_[index], heap_[smallest]);
+    place(index);
+    index = smallest;
+  }
+  place(index);
+}
+
+void ComponentRenderTracker::place(size_t index) {
+  slotById_[heap_[index].componentId] = static_cast<int32_t>(index);
+}
+
+std::vector<ComponentRenderTracker::Stats> ComponentRenderTracker::top(size_t maxCount) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<const Counter*> sorted;
+  sorted.reserve(heap_.size());
+  for (const Counter& counter : heap_) {
+    sorted.push_back(&counter);
+  }
+  size_t count = std::min(maxCount, sorted.size());
+  std::partial_sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(count), sorted.end(),
+                    [](const Counter* a, const Counter* b) { return a->count > b->count; });
+
+  std::vector<Stats> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    const Counter& counter = *sorted[i];
+    Stats stats;
+    stats.componentId = names_[counter.componentId];
+    stats.renderCount = counter.count;
+    stats.countError = counter.error;
+    stats.totalDurationMs = counter.totalDurationMs;
+    stats.maxDurationMs = counter.maxDurationMs;
+    stats.lastDurationMs = counter.lastDurationMs;
+    stats.mountCount = counter.phaseCounts[kMount];
+    stats.updateCount = counter.phaseCounts[kUpdate];
+    stats.nestedUpdateCount = counter.phaseCounts[kNestedUpdate];
+    result.push_back(std::move(stats));
+  }
+  return result;
+}
+
+void ComponentRenderTracker::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const Counter& counter : heap_) {
+    slotById_[counter.componentId] = kNoSlot;
+  }
+  heap_.clear();
+}
+
+} // namespace nitroperf
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nitroperf {
+
+/**
+ * Per-component React render stats with bounded memory.
+ *
+ * Component names are interned once into small integer ids, so a render
+ * report is three numbers. The hottest components are tracked with the
+ * Space-Saving algorithm: a fixed set of counters kept in a min-heap by
+ * render count. A component without a counter takes over the smallest
+ * one and inherits its count as an error bound, so every component with
+ * more than (total renders / capacity) renders is guaranteed to be
+ * present, and each reported count overestimates by at most `countError`.
+ * Duration and phase counters cover only the time a component has held
+ * its counter.
+ *
+ * Threading: all methods may be called from any thread and are serialized
+ * by an internal mutex (in practice reports and reads both come from the
+ * JS thread, so it is uncontended). record() is O(log capacity).
+ */
+class ComponentRenderTracker {
+public:
+  enum Phase : uint32_t {
+    kMount,
+    kUpdate,
+    kNestedUpdate,
+  };
+
+  struct Stats {
+    std::string componentId;
+    uint64_t renderCount = 0;
+    uint64_t countError = 0; // renderCount - countError <= true count <= renderCount
+    double totalDurationMs = 0.0;
+    double maxDurationMs = 0.0;
+    double lastDurationMs = 0.0;
+    uint64_t mountCount = 0;
+    uint64_t updateCount = 0;
+    uint64_t nestedUpdateCount = 0;
+  };
+
+  // Interned names beyond this all report as kOverflowName
+  static constexpr size_t kMaxComponents = 4096;
+  static constexpr std::string_view kOverflowName = "(other)";
+
+  explicit ComponentRenderTracker(size_t capacity = 256);
+
+  /** Stable id for a component name; ids survive clear(). */
+  uint32_t intern(std::string_view name);
+
+  /** Record one commit of an interned component. Unknown ids are ignored. */
+  void record(uint32_t componentId, Phase phase, double durationMs);
+
+  /** Up to `maxCount` tracked components, most renders first. */
+  std::vector<Stats> top(size_t maxCount) const;
+
+  /** Drop all counters. Interned ids stay valid. */
+  void clear();
+
+private:
+  static constexpr int32_t kNoSlot = -1;
+
+  struct Counter {
+    uint32_t componentId;
+    uint64_t count;
+    uint64_t error;
+    double totalDurationMs;
+    double maxDurationMs;
+    double lastDurationMs;
+    uint64_t phaseCounts[3];
+  };
+
+  void siftDown(size_t index);
+  void place(size_t index);
+
+  const size_t capacity_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, uint32_t> idsByName_;
+  std::vector<std::string> names_;
+  std::vector<int32_t> slotById_;  // heap index of each id's counter, or kNoSlot
+  std::vector<Counter> heap_;      // min-heap by count, at most capacity_
+};
+
+} // namespace nitroperf
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nitroperf {
+
+/**
+ * Copy-on-write list with a single lock-free reader.
+ *
+ * Writers copy the current list, modify the copy and publish it with one
+ * atomic store, serialized by a writer-only mutex. The reader (one
+ * dispatch thread) iterates whichever immutable list is current without
+ * taking any lock, so callbacks never run under the writer mutex and a
+ * writer never waits for a dispatch to finish.
+ *
+ * Reclamation: while a dispatch is in progress, replaced lists are
+ * parked in retired_ and freed either by the reader once it finishes or
+ * by the next writer that observes no dispatch in progress.
+ */
+template <typename T>
+class CopyOnWriteList {
+public:
+  using List = std::vector<T>;
+
+  CopyOnWriteList() : current_(new List()) {}
+  ~CopyOnWriteList() { delete current_.load(std::memory_order_relaxed); }
+
+  CopyOnWriteList(const CopyOnWriteList&) = delete;
+  CopyOnWriteList& operator=(const CopyOnWriteList&) = delete;
+
+  /** Apply `mutate` to a copy of the list and publish it. Any thread. */
+  template <typename Fn>
+  void update(Fn&& mutate) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    const List* old = current_.load(std::memory_order_relaxed);
+    auto next = std::make_unique<List>(*old);
+    mutate(*next);
+    current_.store(next.release(), std::memory_order_seq_cst);
+
+    if (dispatchSeq_.load(std::memory_order_seq_cst) & 1) {
+      // The reader may still be iterating `old`
+      retired_.emplace_back(old);
+    } else {
+      // No dispatch in flight: a new one will load the list we just stored
+      retired_.clear();
+      delete old;
+    }
+  }
+
+  /**
+   * Invoke `fn` for every item of the current list. Single reader thread
+   * only. `fn` may call update() (e.g. unsubscribe from a callback).
+   */
+  template <typename Fn>
+  void forEach(Fn&& fn) {
+    dispatchSeq_.fetch_add(1, std::memory_order_seq_cst);
+    const List* list = current_.load(std::memory_order_seq_cst);
+    for (const T& item : *list) {
+      fn(item);
+    }
+    dispatchSeq_.fetch_add(1, std::memory_order_release);
+
+    // Everything retired so far was retired during this or an earlier
+    // dispatch, so it is unreachable now. Never wait for a writer here.
+    std::unique_lock<std::mutex> lock(writeMutex_, std::try_to_lock);
+    if (lock.owns_lock()) {
+      retired_.clear();
+    }
+  }
+
+  /** Number of items in the current list. */
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    return current_.load(std::memory_order_relaxed)->size();
+  }
+
+private:
+  std::atomic<const List*> current_;
+  std::atomic<uint64_t> dispatchSeq_{0}; // odd while forEach() is iterating
+  mutable std::mutex writeMutex_;
+  std::vector<std::unique_ptr<const List>> retired_; // guarded by writeMutex_
+};
+
+} // namespace nitroperf
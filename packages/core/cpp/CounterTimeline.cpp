@@ -0,0 +1,63 @@
+#include "CounterTimeline.hpp"
+#include <algorithm>
+
+namespace nitroperf {
+
+void CounterTimeline::record(int64_t timeNs, int32_t source, const Counters& counters) {
+  if (source != source_) {
+    source_ = source;
+    count_ = 0;
+    next_ = 0;
+  }
+  samples_[next_] = Sample{timeNs, counters};
+  next_ = (next_ + 1) % kCapacity;
+  count_ = std::min(count_ + 1, kCapacity);
+}
+
+int64_t CounterTimeline::latestNs() const {
+  return count_ == 0 ? 0 : at(count_ - 1).timeNs;
+}
+
+const CounterTimeline::Sample& CounterTimeline::at(size_t i) const {
+  return samples_[(next_ + kCapacity - count_ + i) % kCapacity];
+}
+
+CounterTimeline::Counters CounterTimeline::interpolate(int64_t timeNs) const {
+  if (timeNs <= at(0).timeNs) return at(0).counters;
+  if (timeNs >= at(count_ - 1).timeNs) return at(count_ - 1).counters;
+
+  // First sample at or after timeNs; the ring is in time order
+  size_t low = 1, high = count_ - 1;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    if (at(mid).timeNs < timeNs) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  const Sample& before = at(low - 1);
+  const Sample& after = at(low);
+  double fraction = static_cast<double>(timeNs - before.timeNs) /
+                    static_cast<double>(std::max<int64_t>(after.timeNs - before.timeNs, 1));
+  Counters result;
+  for (size_t i = 0; i < result.size(); i++) {
+    int64_t a = before.counters[i];
+    result[i] = a + static_cast<int64_t>(static_cast<double>(after.counters[i] - a) * fraction);
+  }
+  return result;
+}
+
+CounterTimeline::Counters CounterTimeline::between(int64_t fromNs, int64_t toNs) const {
+  if (count_ < 2 || toNs <= fromNs) return Counters{};
+  Counters from = interpolate(fromNs);
+  Counters to = interpolate(toNs);
+  Counters delta;
+  for (size_t i = 0; i < delta.size(); i++) {
+    // Counters only grow; a smaller one wrapped (32-bit Mach counters)
+    delta[i] = std::max<int64_t>(to[i] - from[i], 0);
+  }
+  return delta;
+}
+
+} // namespace nitroperf
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace nitroperf {
+
+/**
+ * Recent samples of a pair of cumulative counters (a thread's on-CPU and
+ * run-queue ns, the process's page faults), so the increase over any
+ * recent window (a stutter episode, say) can be estimated after the
+ * fact. Counters are interpolated linearly between samples, which makes
+ * the sampling interval the resolution. A sample from a different
+ * source (a role moved to a new thread) starts the timeline over.
+ * Fixed size, ~6 KB.
+ *
+ * Threading: not synchronized; the owner serializes all calls.
+ */
+class CounterTimeline {
+public:
+  // ~2 min at the default 500 ms update interval
+  static constexpr size_t kCapacity = 256;
+
+  using Counters = std::array<int64_t, 2>;
+
+  /**
+   * Append counters read at `timeNs` (Timebase::nowNs()) from `source`:
+   * a thread id, or 0 for process-wide counters.
+   */
+  void record(int64_t timeNs, int32_t source, const Counters& counters);
+
+  /**
+   * Increase of each counter during [fromNs, toNs], clamped to the
+   * sampled span. Zero before two samples exist.
+   */
+  Counters between(int64_t fromNs, int64_t toNs) const;
+
+  /** Time of the newest sample; 0 if none. */
+  int64_t latestNs() const;
+
+private:
+  struct Sample {
+    int64_t timeNs;
+    Counters counters;
+  };
+
+  /** i-th retained sample, oldest first. */
+  const Sample& at(size_t i) const;
+  /** Counters interpolated at `timeNs`. */
+  Counters interpolate(int64_t timeNs) const;
+
+  std::array<Sample, kCapacity> samples_{};
+  size_t next_ = 0;
+  size_t count_ = 0;
+  int32_t source_ = 0;
+};
+
+} // namespace nitroperf
@@ -4,121 +4,661 @@
 
 namespace nitroperf {
 
-FPSTracker::FPSTracker(size_t maxSamples)
-    : maxSamples_(maxSamples), samples_(maxSamples, 0) {}
+namespace {
+constexpr auto kRelaxed = std::memory_order_relaxed;
+
+// Gaps longer than this mean the frame source paused (app backgrounded,
+// screen off, monitor restarted) rather than the app skipping frames.
+constexpr double kMaxFrameGapSeconds = 2.0;
+
+// Relative change of the median period that counts as a refresh-rate switch,
+// and relative tolerance for an interval to "match" a period.
+constexpr double kRateSwitchTolerance = 0.25;
+
+bool matchesPeriod(double interval, double period) {
+  return std::abs(interval / period - 1.0) < kRateSwitchTolerance;
+}
+
+/** Marks a reader that may dereference ring_ (RCU read-side section). */
+class ReaderScope {
+public:
+  explicit ReaderScope(std::atomic<int>& readers) : readers_(readers) {
+    readers_.fetch_add(1, std::memory_order_seq_cst);
+  }
+  ~ReaderScope() { readers_.fetch_sub(1, std::memory_order_release); }
+
+private:
+  std::atomic<int>& readers_;
+};
+} // namespace
+
+FPSTracker::Ring::Ring(size_t capacity)
+    : capacity(capacity), slots(new std::atomic<int>[capacity]) {
+  for (size_t i = 0; i < capacity; i++) {
+    slots[i].store(0, kRelaxed);
+  }
+}
+
+FPSTracker::TickRing::TickRing(size_t capacity)
+    : capacity(capacity), slots(new std::atomic<int64_t>[capacity]) {
+  for (size_t i = 0; i < capacity; i++) {
+    slots[i].store(0, kRelaxed);
+  }
+}
+
+FPSTracker::FPSTracker(size_t maxSamples, JankListener onJank)
+    : onJank_(std::move(onJank)),
+      ring_(new Ring(std::max<size_t>(maxSamples, 1))),
+      requestedCapacity_(std::max<size_t>(maxSamples, 1)) {}
+
+FPSTracker::~FPSTracker() {
+  // The producer must have stopped ticking before destruction.
+  delete ring_.load(kRelaxed);
+  delete pendingRing_.load(kRelaxed);
+  delete retiredRing_;
+  delete tickRing_;
+  delete pendingTickRing_.load(kRelaxed);
+  delete retiredTickRing_;
+}
 
 void FPSTracker::onFrameTick(double timestampSeconds) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  applyPendingControl();
+  ingestTick(timestampSeconds);
+}
+
+void FPSTracker::onFrameTicks(const double* timestamps, size_t count, double secondsPerUnit,
+                              double offsetSeconds) {
+  // Control requests are checked once per batch instead of once per tick
+  applyPendingControl();
+  for (size_t i = 0; i < count; i++) {
+    ingestTick(timestamps[i] * secondsPerUnit + offsetSeconds);
+  }
+}
+
+void FPSTracker::applyPendingControl() {
+  if (retiredRing_ != nullptr || retiredTickRing_ != nullptr) {
+    reclaimRetiredRings();
+  }
+  if (retiredRing_ == nullptr && pendingRing_.load(kRelaxed) != nullptr) {
+    applyResize();
+  }
+  if (retiredTickRing_ == nullptr && pendingTickRing_.load(kRelaxed) != nullptr) {
+    applyTickCapture();
+  }
+
+  uint32_t epoch = resetEpoch_.load(std::memory_order_acquire);
+  if (epoch != appliedEpoch_) {
+    applyReset(epoch);
+  }
+}
+
+void FPSTracker::ingestTick(double timestampSeconds) {
+  if (tickRing_ != nullptr) {
+    recordRawTick(timestampSeconds);
+  }
 
   if (!hasFirstTick_) {
     windowStart_ = timestampSeconds;
+    lastTickTimestamp_ = timestampSeconds;
     frameCount_ = 1;
     hasFirstTick_ = true;
     return;
   }
 
+  double interval = timestampSeconds - lastTickTimestamp_;
+  lastTickTimestamp_ = timestampSeconds;
+
+  if (interval > 0.0 && interval <= kMaxFrameGapSeconds) {
+    // Longer gaps are pauses (backgrounding, stop/start), not frames, and
+    // would swamp the tail of the frame-time histogram
+    frameTimes_.record(static_cast<uint64_t>(std::llround(interval * 1e6)));
+
+    // Classify against the period measured *before* this interval, so a
+    // single long frame can't stretch its own yardstick.
+    double period = vsyncPeriod();
+    int64_t skipped = 0;
+    if (period > 0.0) {
+      skipped = std::max<int64_t>(0, std::llround(interval / period) - 1);
+      windowDropped_ += skipped;
+    }
+    observeInterval(interval, skipped);
+    bool episodeStart = (skipped > 0 || episodeOpen_) && trackEpisode(timestampSeconds, interval, skipped);
+
+    // Edge-triggered: a run of long frames signals once
+    double jankThreshold = jankThresholdSeconds_.load(kRelaxed);
+    bool overThreshold = jankThreshold > 0.0 && interval > jankThreshold;
+    bool crossedThreshold = overThreshold && !overJankThreshold_;
+    overJankThreshold_ = overThreshold;
+
+    if ((episodeStart || crossedThreshold) && onJank_) {
+      JankOnset onset;
+      onset.frameEndNs = std::llround(timestampSeconds * 1e9);
+      onset.frameNs = std::llround(interval * 1e9);
+      onset.framesSkipped = skipped;
+      onset.episodeStart = episodeStart;
+      onset.overThreshold = crossedThreshold;
+      onJank_(onset);
+    }
+  } else if (episodeOpen_) {
+    // The source paused; the pause itself isn't part of the stutter
+    closeEpisode();
+  }
+
   frameCount_++;
   double elapsed = timestampSeconds - windowStart_;
 
   // Once a full second has elapsed, record the sample
   if (elapsed >= 1.0) {
     int fps = static_cast<int>(std::round(frameCount_ / elapsed));
-    recordSample(fps);
+    recordSample(fps, windowDropped_);
 
     // Start new window
     windowStart_ = timestampSeconds;
     frameCount_ = 0;
+    windowDropped_ = 0;
+  }
+}
+
+void FPSTracker::recordRawTick(double timestampSeconds) {
+  TickRing* ring = tickRing_;
+  uint64_t sequence = nextTickSequence_++;
+  ring->lock.beginWrite();
+  ring->slots[sequence % ring->capacity].store(std::llround(timestampSeconds * 1e9), kRelaxed);
+  ring->next.store(sequence + 1, kRelaxed);
+  ring->lock.endWrite();
+}
+
+void FPSTracker::observeInterval(double interval, int64_t skipped) {
+  // Keep a sorted copy of the window in step, so the median is one read:
+  // remove the interval about to be overwritten, then insert the new one
+  auto sortedEnd = sortedIntervals_.begin() + static_cast<std::ptrdiff_t>(recentIntervalCount_);
+  if (recentIntervalCount_ == kVsyncWindow) {
+    auto evicted = std::lower_bound(sortedIntervals_.begin(), sortedEnd, recentIntervals_[recentIntervalIndex_]);
+    std::copy(evicted + 1, sortedEnd, evicted);
+    --sortedEnd;
+  }
+  auto slot = std::upper_bound(sortedIntervals_.begin(), sortedEnd, interval);
+  std::copy_backward(slot, sortedEnd, sortedEnd + 1);
+  *slot = interval;
+
+  recentIntervals_[recentIntervalIndex_] = interval;
+  recentSkipped_[recentIntervalIndex_] = skipped;
+  recentIntervalIndex_ = (recentIntervalIndex_ + 1) % kVsyncWindow;
+  if (recentIntervalCount_ < kVsyncWindow) {
+    recentIntervalCount_++;
+  }
+
+  if (recentIntervalCount_ < kMinVsyncSamples) return;
+
+  double previous = measuredVsyncPeriod_;
+  measuredVsyncPeriod_ = sortedIntervals_[recentIntervalCount_ / 2];
+
+  // Refresh-rate switch: intervals at the new cadence were charged as
+  // skips against the old period. Retract those; real hitches stay.
+  if (previous > 0.0 && !matchesPeriod(measuredVsyncPeriod_, previous)) {
+    for (size_t i = 0; i < recentIntervalCount_; i++) {
+      if (recentSkipped_[i] > 0 && matchesPeriod(recentIntervals_[i], measuredVsyncPeriod_)) {
+        windowDropped_ -= recentSkipped_[i];
+        recentSkipped_[i] = 0;
+      }
+    }
+  }
+}
+
+bool FPSTracker::trackEpisode(double timestampSeconds, double interval, int64_t skipped) {
+  int64_t endNs = std::llround(timestampSeconds * 1e9);
+  int64_t mergeGapNs = episodeMergeGapNs_.load(kRelaxed);
+
+  if (skipped == 0) {
+    // A later slow frame starts no earlier than this tick, so once the gap
+    // is exceeded nothing can extend the episode any more
+    if (endNs - openEpisode_.endNs > mergeGapNs) closeEpisode();
+    return false;
+  }
+
+  int64_t frameNs = std::llround(interval * 1e9);
+  int64_t startNs = endNs - frameNs;
+  if (episodeOpen_ && startNs - openEpisode_.endNs > mergeGapNs) {
+    closeEpisode();
+  }
+  bool opened = !episodeOpen_;
+  if (opened) {
+    openEpisode_ = StutterEpisode{};
+    openEpisode_.startNs = startNs;
+    episodeOpen_ = true;
+  }
+  openEpisode_.endNs = endNs;
+  openEpisode_.framesSkipped += skipped;
+  openEpisode_.worstFrameNs = std::max(openEpisode_.worstFrameNs, frameNs);
+  openEpisode_.slowFrames++;
+  return opened;
+}
+
+void FPSTracker::closeEpisode() {
+  episodeOpen_ = false;
+  uint64_t sequence = nextEpisode_.load(kRelaxed);
+  EpisodeSlot& slot = episodes_[sequence % kEpisodeCapacity];
+
+  episodeLock_.beginWrite();
+  slot.startNs.store(openEpisode_.startNs, kRelaxed);
+  slot.endNs.store(openEpisode_.endNs, kRelaxed);
+  slot.framesSkipped.store(openEpisode_.framesSkipped, kRelaxed);
+  slot.worstFrameNs.store(openEpisode_.worstFrameNs, kRelaxed);
+  slot.slowFrames.store(openEpisode_.slowFrames, kRelaxed);
+  nextEpisode_.store(sequence + 1, kRelaxed);
+  episodeLock_.endWrite();
+}
+
+double FPSTracker::vsyncPeriod() const {
+  if (measuredVsyncPeriod_ > 0.0) return measuredVsyncPeriod_;
+  int target = targetFps_.load(kRelaxed);
+  return target > 0 ? 1.0 / target : 0.0;
+}
+
+void FPSTracker::applyReset(uint32_t epoch) {
+  windowStart_ = 0.0;
+  frameCount_ = 0;
+  hasFirstTick_ = false;
+  lastTickTimestamp_ = 0.0;
+  windowDropped_ = 0;
+  appliedEpoch_ = epoch;
+  recentIntervalCount_ = 0;
+  recentIntervalIndex_ = 0;
+  measuredVsyncPeriod_ = 0.0;
+  episodeOpen_ = false;
+  overJankThreshold_ = false;
+
+  Ring* ring = ring_.load(kRelaxed);
+  publishLock_.beginWrite();
+  for (size_t i = 0; i < ring->capacity; i++) {
+    ring->slots[i].store(0, kRelaxed);
+  }
+  writeIndex_.store(0, kRelaxed);
+  sampleCount_.store(0, kRelaxed);
+  currentFps_.store(0, kRelaxed);
+  minFps_.store(INT32_MAX, kRelaxed);
+  maxFps_.store(0, kRelaxed);
+  droppedFrames_.store(0, kRelaxed);
+  stutterCount_.store(0, kRelaxed);
+  refreshRateHz_.store(0.0, kRelaxed);
+  frameTimes_.clear();
+  publishedEpoch_.store(epoch, kRelaxed);
+  generation_.fetch_add(1, kRelaxed);
+  // Burn a sequence number so a cursor taken right before the reset is
+  // still recognised as stale
+  uint64_t resetSequence = nextSequence_.load(kRelaxed) + 1;
+  nextSequence_.store(resetSequence, kRelaxed);
+  resetSequence_.store(resetSequence, kRelaxed);
+  publishLock_.endWrite();
+
+  episodeLock_.beginWrite();
+  clearedEpisodes_.store(nextEpisode_.load(kRelaxed), kRelaxed);
+  episodeLock_.endWrite();
+
+  if (tickRing_ != nullptr) {
+    tickRing_->lock.beginWrite();
+    tickRing_->first.store(nextTickSequence_, kRelaxed);
+    tickRing_->cleared.store(nextTickSequence_, kRelaxed);
+    tickRing_->lock.endWrite();
+  }
+}
+
+void FPSTracker::applyResize() {
+  Ring* fresh = pendingRing_.exchange(nullptr, std::memory_order_acq_rel);
+  if (fresh == nullptr) return;
+
+  Ring* old = ring_.load(kRelaxed);
+  size_t sampleCount = sampleCount_.load(kRelaxed);
+  size_t writeIndex = writeIndex_.load(kRelaxed);
+
+  // Carry over the newest samples, oldest first
+  size_t keep = std::min(sampleCount, fresh->capacity);
+  for (size_t i = 0; i < keep; i++) {
+    size_t src = (writeIndex + old->capacity - keep + i) % old->capacity;
+    fresh->slots[i].store(old->slots[src].load(kRelaxed), kRelaxed);
   }
+
+  publishLock_.beginWrite();
+  ring_.store(fresh, std::memory_order_seq_cst);
+  writeIndex_.store(keep % fresh->capacity, kRelaxed);
+  sampleCount_.store(keep, kRelaxed);
+  generation_.fetch_add(1, kRelaxed);
+  publishLock_.endWrite();
+
+  retiredRing_ = old;
 }
 
-void FPSTracker::recordSample(int fps) {
+void FPSTracker::applyTickCapture() {
+  TickRing* fresh = pendingTickRing_.exchange(nullptr, std::memory_order_acq_rel);
+  if (fresh == nullptr) return;
+
+  TickRing* old = tickRing_;
+  if (fresh->capacity == 0) {
+    delete fresh;
+    fresh = nullptr;
+  } else if (old != nullptr) {
+    // Carry over the newest ticks, so a capacity change loses nothing
+    uint64_t available = nextTickSequence_ - old->first.load(kRelaxed);
+    uint64_t keep = std::min<uint64_t>(std::min<uint64_t>(available, old->capacity), fresh->capacity);
+    for (uint64_t sequence = nextTickSequence_ - keep; sequence < nextTickSequence_; sequence++) {
+      fresh->slots[sequence % fresh->capacity].store(old->slots[sequence % old->capacity].load(kRelaxed), kRelaxed);
+    }
+    fresh->next.store(nextTickSequence_, kRelaxed);
+    fresh->first.store(nextTickSequence_ - keep, kRelaxed);
+    fresh->cleared.store(old->cleared.load(kRelaxed), kRelaxed);
+  } else {
+    fresh->next.store(nextTickSequence_, kRelaxed);
+    fresh->first.store(nextTickSequence_, kRelaxed);
+    fresh->cleared.store(nextTickSequence_, kRelaxed);
+  }
+
+  publishedTickRing_.store(fresh, std::memory_order_seq_cst);
+  retiredTickRing_ = old;
+  tickRing_ = fresh;
+}
+
+void FPSTracker::reclaimRetiredRings() {
+  // Readers register before loading ring_ / publishedTickRing_, and those
+  // were swapped before this check, so once the count reads zero nobody
+  // can hold a retired ring.
+  if (activeReaders_.load(std::memory_order_seq_cst) == 0) {
+    delete retiredRing_;
+    retiredRing_ = nullptr;
+    delete retiredTickRing_;
+    retiredTickRing_ = nullptr;
+  }
+}
+
+void FPSTracker::recordSample(int fps, int64_t dropped) {
+  // The producer is the only writer, so it can read its own published
+  // values back without synchronization.
+  Ring* ring = ring_.load(kRelaxed);
+  size_t writeIndex = writeIndex_.load(kRelaxed);
+  size_t sampleCount = sampleCount_.load(kRelaxed);
+
+  double period = vsyncPeriod();
+
+  // `dropped` can be negative when a refresh-rate switch retracted skips
+  // that were already published with the previous window.
+  int64_t droppedTotal = std::max<int64_t>(0, droppedFrames_.load(kRelaxed) + dropped);
+
+  publishLock_.beginWrite();
+
   // Write to ring buffer
-  samples_[writeIndex_] = fps;
-  writeIndex_ = (writeIndex_ + 1) % maxSamples_;
-  if (sampleCount_ < maxSamples_) {
-    sampleCount_++;
+  ring->slots[writeIndex].store(fps, kRelaxed);
+  writeIndex_.store((writeIndex + 1) % ring->capacity, kRelaxed);
+  if (sampleCount < ring->capacity) {
+    sampleCount_.store(sampleCount + 1, kRelaxed);
   }
 
-  currentFps_.store(fps, std::memory_order_relaxed);
+  currentFps_.store(fps, kRelaxed);
+  generation_.fetch_add(1, kRelaxed);
+  nextSequence_.fetch_add(1, kRelaxed);
 
   // Update min/max
-  if (fps < minFps_) minFps_ = fps;
-  if (fps > maxFps_) maxFps_ = fps;
+  if (fps < minFps_.load(kRelaxed)) minFps_.store(fps, kRelaxed);
+  if (fps > maxFps_.load(kRelaxed)) maxFps_.store(fps, kRelaxed);
 
-  // Dropped frames: how many frames below target in this second
-  int dropped = std::max(0, targetFps_ - fps);
-  droppedFrames_ += dropped;
+  droppedFrames_.store(droppedTotal, kRelaxed);
+  refreshRateHz_.store(period > 0.0 ? 1.0 / period : 0.0, kRelaxed);
 
   // Stutter: 4+ frames dropped in a single second
   if (dropped >= 4) {
-    stutterCount_++;
+    stutterCount_.store(stutterCount_.load(kRelaxed) + 1, kRelaxed);
   }
+
+  publishLock_.endWrite();
+}
+
+bool FPSTracker::isCurrentEpoch() const {
+  // A reset() the producer has not applied yet hides everything published
+  // before it, so readers see the reset without waiting for the next tick.
+  return publishedEpoch_.load(kRelaxed) == resetEpoch_.load(kRelaxed);
 }
 
 int FPSTracker::getCurrentFps() const {
-  return currentFps_.load(std::memory_order_relaxed);
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? currentFps_.load(kRelaxed) : 0;
+  });
 }
 
-std::vector<int> FPSTracker::getSamples() const {
-  std::lock_guard<std::mutex> lock(mutex_);
+FPSTracker::Stats FPSTracker::getStats() const {
+  return publishLock_.read([this] {
+    Stats stats;
+    if (!isCurrentEpoch()) return stats;
 
+    stats.currentFps = currentFps_.load(kRelaxed);
+    stats.minFps = sampleCount_.load(kRelaxed) > 0 ? minFps_.load(kRelaxed) : 0;
+    stats.maxFps = maxFps_.load(kRelaxed);
+    stats.droppedFrames = droppedFrames_.load(kRelaxed);
+    stats.stutterCount = stutterCount_.load(kRelaxed);
+    stats.refreshRateHz = refreshRateHz_.load(kRelaxed);
+    return stats;
+  });
+}
+
+std::vector<int> FPSTracker::getSamples(uint64_t* generation) const {
   std::vector<int> result;
-  result.reserve(sampleCount_);
+  ReaderScope scope(activeReaders_);
+
+  publishLock_.read([&] {
+    result.clear();
+    if (generation != nullptr) *generation = currentGeneration();
+    if (!isCurrentEpoch()) return true;
 
-  if (sampleCount_ < maxSamples_) {
-    // Buffer hasn't wrapped yet — samples are in order from index 0
-    for (size_t i = 0; i < sampleCount_; i++) {
-      result.push_back(samples_[i]);
+    const Ring* ring = ring_.load(std::memory_order_seq_cst);
+    size_t sampleCount = sampleCount_.load(kRelaxed);
+    size_t writeIndex = writeIndex_.load(kRelaxed);
+    result.reserve(ring->capacity);
+
+    if (sampleCount < ring->capacity) {
+      // Buffer hasn't wrapped yet — samples are in order from index 0
+      for (size_t i = 0; i < sampleCount; i++) {
+        result.push_back(ring->slots[i].load(kRelaxed));
+      }
+    } else {
+      // Buffer has wrapped — read from writeIndex (oldest) forward
+      for (size_t i = 0; i < ring->capacity; i++) {
+        size_t idx = (writeIndex + i) % ring->capacity;
+        result.push_back(ring->slots[idx].load(kRelaxed));
+      }
     }
-  } else {
-    // Buffer has wrapped — read from writeIndex_ (oldest) forward
-    for (size_t i = 0; i < maxSamples_; i++) {
-      size_t idx = (writeIndex_ + i) % maxSamples_;
-      result.push_back(samples_[idx]);
+    return true;
+  });
+
+  return result;
+}
+
+FPSTracker::SamplesSince FPSTracker::getSamplesSince(uint64_t cursor) const {
+  SamplesSince result;
+  ReaderScope scope(activeReaders_);
+
+  publishLock_.read([&] {
+    result.samples.clear();
+    result.missed = 0;
+    result.reset = false;
+
+    uint64_t next = nextSequence_.load(kRelaxed);
+    result.cursor = next;
+    if (!isCurrentEpoch()) {
+      // Reset requested but not applied yet: everything is hidden
+      result.reset = true;
+      return true;
     }
-  }
+
+    const Ring* ring = ring_.load(std::memory_order_seq_cst);
+    size_t sampleCount = sampleCount_.load(kRelaxed);
+    size_t writeIndex = writeIndex_.load(kRelaxed);
+    uint64_t oldest = next - sampleCount;
+
+    uint64_t from = cursor;
+    if (cursor < resetSequence_.load(kRelaxed) || cursor > next) {
+      result.reset = true;
+      from = oldest;
+    } else if (cursor < oldest) {
+      // Wrapped past the cursor: report the gap instead of stale data
+      result.missed = oldest - cursor;
+      from = oldest;
+    }
+
+    // Bounded by the ring even if this attempt read torn values (the
+    // seqlock retries it)
+    size_t count = static_cast<size_t>(std::min<uint64_t>(next - from, ring->capacity));
+    result.samples.reserve(count);
+    for (size_t age = count; age > 0; age--) { // age 1 = newest
+      size_t idx = (writeIndex + ring->capacity - age % ring->capacity) % ring->capacity;
+      result.samples.push_back(ring->slots[idx].load(kRelaxed));
+    }
+    return true;
+  });
+
+  return result;
+}
+
+FPSTracker::RawTicks FPSTracker::getRawTicksSince(uint64_t cursor) const {
+  RawTicks result;
+  result.cursor = cursor;
+  ReaderScope scope(activeReaders_);
+
+  const TickRing* ring = publishedTickRing_.load(std::memory_order_seq_cst);
+  if (ring == nullptr) return result;
+
+  ring->lock.read([&] {
+    result.timestampsNs.clear();
+    uint64_t next = ring->next.load(kRelaxed);
+    uint64_t first = ring->first.load(kRelaxed);
+    uint64_t oldest = std::max(first, next > ring->capacity ? next - ring->capacity : uint64_t{0});
+
+    // Ticks before `cleared` were dropped on purpose; only overwritten
+    // ones are reported as missed
+    uint64_t from = std::max(std::min(cursor, next), ring->cleared.load(kRelaxed));
+    result.missed = oldest > from ? oldest - from : 0;
+    from = std::max(from, oldest);
+    result.cursor = next;
+
+    // Bounded by the ring even if this attempt read torn values
+    size_t count = next > from ? static_cast<size_t>(std::min<uint64_t>(next - from, ring->capacity)) : 0;
+    result.timestampsNs.reserve(count);
+    for (uint64_t sequence = next - count; sequence < next; sequence++) {
+      result.timestampsNs.push_back(ring->slots[sequence % ring->capacity].load(kRelaxed));
+    }
+    return true;
+  });
 
   return result;
 }
 
+FPSTracker::EpisodesSince FPSTracker::getEpisodesSince(uint64_t cursor) const {
+  EpisodesSince result;
+  episodeLock_.read([&] {
+    result.episodes.clear();
+    uint64_t next = nextEpisode_.load(kRelaxed);
+    result.cursor = next;
+    // A pending reset() hides everything, like the sample history
+    if (!isCurrentEpoch()) return true;
+
+    uint64_t oldest = next > kEpisodeCapacity ? next - kEpisodeCapacity : 0;
+    uint64_t from = std::max(std::min(cursor, next), clearedEpisodes_.load(kRelaxed));
+    result.missed = oldest > from ? oldest - from : 0;
+    from = std::max(from, oldest);
+
+    // Bounded by the log even if this attempt read torn values
+    size_t count = next > from ? static_cast<size_t>(std::min<uint64_t>(next - from, kEpisodeCapacity)) : 0;
+    result.episodes.reserve(count);
+    for (uint64_t sequence = next - count; sequence < next; sequence++) {
+      const EpisodeSlot& slot = episodes_[sequence % kEpisodeCapacity];
+      StutterEpisode episode;
+      episode.startNs = slot.startNs.load(kRelaxed);
+      episode.endNs = slot.endNs.load(kRelaxed);
+      episode.framesSkipped = slot.framesSkipped.load(kRelaxed);
+      episode.worstFrameNs = slot.worstFrameNs.load(kRelaxed);
+      episode.slowFrames = slot.slowFrames.load(kRelaxed);
+      result.episodes.push_back(episode);
+    }
+    return true;
+  });
+  return result;
+}
+
+uint64_t FPSTracker::getGeneration() const {
+  return publishLock_.read([this] { return currentGeneration(); });
+}
+
+uint64_t FPSTracker::currentGeneration() const {
+  // A pending reset() already empties what readers see, so it must bump
+  // the generation before the producer gets around to applying it.
+  return generation_.load(kRelaxed) + resetEpoch_.load(kRelaxed);
+}
+
 int FPSTracker::getMinFps() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return sampleCount_ > 0 ? minFps_ : 0;
+  return publishLock_.read([this] {
+    if (!isCurrentEpoch() || sampleCount_.load(kRelaxed) == 0) return 0;
+    return minFps_.load(kRelaxed);
+  });
 }
 
 int FPSTracker::getMaxFps() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return maxFps_;
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? maxFps_.load(kRelaxed) : 0;
+  });
 }
 
 int64_t FPSTracker::getDroppedFrames() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return droppedFrames_;
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? droppedFrames_.load(kRelaxed) : int64_t{0};
+  });
 }
 
 int FPSTracker::getStutterCount() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return stutterCount_;
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? stutterCount_.load(kRelaxed) : 0;
+  });
+}
+
+LatencyHistogram::Snapshot FPSTracker::getFrameTimeHistogram() const {
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? frameTimes_.snapshot() : LatencyHistogram::Snapshot{};
+  });
+}
+
+double FPSTracker::getRefreshRateHz() const {
+  return publishLock_.read([this] {
+    return isCurrentEpoch() ? refreshRateHz_.load(kRelaxed) : 0.0;
+  });
 }
 
 void FPSTracker::setTargetFps(int target) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  targetFps_ = target;
+  targetFps_.store(target, kRelaxed);
+}
+
+void FPSTracker::resize(size_t maxSamples) {
+  maxSamples = std::max<size_t>(maxSamples, 1);
+  if (requestedCapacity_.exchange(maxSamples, kRelaxed) == maxSamples) return;
+
+  // Allocate here, off the producer thread; a pending ring the producer
+  // hasn't picked up yet was never published, so it can be freed directly.
+  Ring* stale = pendingRing_.exchange(new Ring(maxSamples), std::memory_order_acq_rel);
+  delete stale;
+}
+
+void FPSTracker::setRawTickCapture(size_t capacity) {
+  if (requestedTickCapacity_.exchange(capacity, kRelaxed) == capacity) return;
+
+  // Same hand-off as resize(): allocated here, swapped in by the producer
+  TickRing* stale = pendingTickRing_.exchange(new TickRing(capacity), std::memory_order_acq_rel);
+  delete stale;
+}
+
+void FPSTracker::setEpisodeMergeGap(double seconds) {
+  episodeMergeGapNs_.store(seconds > 0 ? std::llround(seconds * 1e9) : 0, kRelaxed);
+}
+
+void FPSTracker::setJankThreshold(double seconds) {
+  jankThresholdSeconds_.store(seconds > 0 ? seconds : 0.0, kRelaxed);
 }
 
 void FPSTracker::reset() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  std::fill(samples_.begin(), samples_.end(), 0);
-  writeIndex_ = 0;
-  sampleCount_ = 0;
-  windowStart_ = 0.0;
-  frameCount_ = 0;
-  hasFirstTick_ = false;
-  currentFps_.store(0, std::memory_order_relaxed);
-  minFps_ = INT32_MAX;
-  maxFps_ = 0;
-  droppedFrames_ = 0;
-  stutterCount_ = 0;
+  resetEpoch_.fetch_add(1, std::memory_order_release);
 }
 
 } // namespace nitroperf
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <cstdint>
-#include <mutex>
+#include <memory>
 #include <atomic>
+#include <functional>
+
+#include "SeqLock.hpp"
+#include "LatencyHistogram.hpp"
 
 namespace nitroperf {
 
@@ -11,22 +16,141 @@ namespace nitroperf {
  * Ring-buffer FPS tracker that counts frame callbacks per second.
  * Algorithm matches RCTFPSGraph.mm: count callbacks in 1-second windows,
  * compute round(frameCount / elapsed).
+ *
+ * Dropped frames are counted per frame interval: the vsync period is
+ * estimated online from the median of recent intervals, and each interval
+ * contributes round(interval / period) - 1 skipped vsyncs. When the
+ * median moves to a new refresh rate (ProMotion, Android display mode
+ * switches), skips already charged to intervals that match the new period
+ * are retracted, so a mode switch doesn't read as a burst of drops and
+ * history is kept.
+ *
+ * Threading: onFrameTick() has a single producer (the UI display link or
+ * the JS rAF loop) and never takes a lock. Per-window state is owned by
+ * the producer; completed samples and stats are published through a
+ * SeqLock, so readers on any thread retry instead of blocking the producer.
+ * reset(), resize(), setTargetFps() and setRawTickCapture() may be
+ * called from any thread.
+ *
+ * Raw tick capture optionally keeps the timestamp of every frame callback
+ * (integer nanoseconds) in a fixed-size ring with its own SeqLock. When
+ * capture is off the producer pays one branch per tick.
+ *
+ * Stutter episodes: consecutive frames that skipped at least one vsync are
+ * merged into one episode while the gap between them is at most the merge
+ * gap. An episode closes once a frame ends more than the merge gap after
+ * it (or the frame source pauses) and goes into a fixed log of the newest
+ * kEpisodeCapacity episodes, published through its own SeqLock.
+ *
+ * Jank onset: the optional listener is called on the producer thread, at
+ * the tick that opens an episode or that first crosses the jank threshold,
+ * so a consumer can react to a hitch without polling. It must not block.
  */
 class FPSTracker {
 public:
-  explicit FPSTracker(size_t maxSamples = 60);
+  /** Samples recorded after a cursor, from getSamplesSince(). */
+  struct SamplesSince {
+    std::vector<int> samples; // oldest first
+    uint64_t cursor = 0;      // pass back on the next call
+    uint64_t missed = 0;      // samples after the cursor already overwritten
+    bool reset = false;       // history was reset since the cursor; discard it
+  };
+
+  /** Raw tick timestamps recorded after a cursor, from getRawTicksSince(). */
+  struct RawTicks {
+    std::vector<int64_t> timestampsNs; // oldest first
+    uint64_t cursor = 0;               // pass back on the next call
+    uint64_t missed = 0;               // ticks after the cursor already overwritten
+  };
+
+  /** A run of slow frames, merged across gaps up to the merge gap. */
+  struct StutterEpisode {
+    int64_t startNs = 0;       // start of the first slow frame
+    int64_t endNs = 0;         // end of the last slow frame
+    int64_t framesSkipped = 0; // vsyncs skipped across the episode
+    int64_t worstFrameNs = 0;  // longest frame interval in the episode
+    int64_t slowFrames = 0;    // frames that skipped at least one vsync
+  };
+
+  /** Closed episodes recorded after a cursor, from getEpisodesSince(). */
+  struct EpisodesSince {
+    std::vector<StutterEpisode> episodes; // oldest first
+    uint64_t cursor = 0;                  // pass back on the next call
+    uint64_t missed = 0;                  // episodes after the cursor already overwritten
+  };
+
+  /** The slow frame that started a hitch, passed to the jank listener. */
+  struct JankOnset {
+    int64_t frameEndNs = 0;
+    int64_t frameNs = 0;
+    int64_t framesSkipped = 0;
+    bool episodeStart = false;  // opened a stutter episode
+    bool overThreshold = false; // first frame over the jank threshold
+  };
+  using JankListener = std::function<void(const JankOnset&)>;
+
+  /** Tracker counters captured together in one consistent read. */
+  struct Stats {
+    int currentFps = 0;
+    int minFps = 0;
+    int maxFps = 0;
+    int64_t droppedFrames = 0;
+    int stutterCount = 0;
+    double refreshRateHz = 0.0;
+  };
+
+  explicit FPSTracker(size_t maxSamples = 60, JankListener onJank = nullptr);
+  ~FPSTracker();
+
+  FPSTracker(const FPSTracker&) = delete;
+  FPSTracker& operator=(const FPSTracker&) = delete;
 
   /**
    * Called on each frame tick with the timestamp in seconds.
    * Counts frames per second and updates the ring buffer.
+   * Must only be called from the tracker's producer thread.
    */
   void onFrameTick(double timestampSeconds);
 
+  /**
+   * Ingest a batch of frame timestamps, oldest first, with the same
+   * results as calling onFrameTick() for each. Each timestamp is mapped
+   * to `timestamp * secondsPerUnit + offsetSeconds` (e.g. 0.001 for
+   * milliseconds plus a clock offset).
+   * Same single-producer rule as onFrameTick().
+   */
+  void onFrameTicks(const double* timestamps, size_t count, double secondsPerUnit = 1.0,
+                    double offsetSeconds = 0.0);
+
   /** Returns the current FPS (most recent completed second). */
   int getCurrentFps() const;
 
-  /** Returns ordered history from the ring buffer (oldest to newest). */
-  std::vector<int> getSamples() const;
+  /**
+   * Returns all counters from the same published state, so e.g.
+   * droppedFrames and currentFps never straddle a reset.
+   */
+  Stats getStats() const;
+
+  /**
+   * Returns ordered history from the ring buffer (oldest to newest).
+   * If `generation` is given it receives the getGeneration() value the
+   * samples correspond to.
+   */
+  std::vector<int> getSamples(uint64_t* generation = nullptr) const;
+
+  /**
+   * Samples recorded after `cursor` (0 = from the start). Every sample
+   * gets a monotonically increasing sequence number; the returned cursor
+   * is one past the newest, so polling costs O(new samples) rather than
+   * O(capacity).
+   */
+  SamplesSince getSamplesSince(uint64_t cursor) const;
+
+  /**
+   * Changes whenever getSamples() would return something different (new
+   * sample, resize, reset). Monotonic, so callers can cache by it.
+   */
+  uint64_t getGeneration() const;
 
   /** Minimum FPS recorded since last reset. */
   int getMinFps() const;
@@ -34,39 +158,189 @@ public:
   /** Maximum FPS recorded since last reset. */
   int getMaxFps() const;
 
-  /** Total dropped frames (expected - actual) across all samples. */
+  /** Total skipped vsyncs across all frame intervals. */
   int64_t getDroppedFrames() const;
 
   /** Number of 1-second windows where 4+ frames were dropped. */
   int getStutterCount() const;
 
-  /** Target FPS for dropped frame calculation. */
+  /**
+   * Distribution of every inter-frame interval since last reset
+   * (microseconds), excluding pauses over 2 s. Each tick records into a
+   * fixed-size histogram, so this is O(1) per frame with no allocation.
+   */
+  LatencyHistogram::Snapshot getFrameTimeHistogram() const;
+
+  /** Refresh rate (Hz) in effect at the last completed second; 0 before the first. */
+  double getRefreshRateHz() const;
+
+  /** Fallback frame rate used until the vsync period has been measured. */
   void setTargetFps(int target);
 
-  /** Reset all tracking state. */
+  /**
+   * Change the history capacity, keeping the newest samples and all stats.
+   * The producer swaps in the new ring on its next tick and frees the old
+   * one only once no reader can still be inside it (RCU-style), so this is
+   * safe while frames are ticking.
+   */
+  void resize(size_t maxSamples);
+
+  /**
+   * Keep the timestamps of the newest `capacity` frame ticks; 0 turns
+   * capture off and frees the ring. Takes effect on the producer's next
+   * tick. Sequence numbers continue across changes, so cursors stay valid.
+   */
+  void setRawTickCapture(size_t capacity);
+
+  /**
+   * Captured tick timestamps recorded after `cursor` (0 = all retained).
+   * Ticks dropped by reset() or by turning capture off don't count as
+   * missed. Returns the cursor unchanged while capture is off.
+   */
+  RawTicks getRawTicksSince(uint64_t cursor) const;
+
+  /**
+   * Slow frames starting at most `seconds` after the previous one ends
+   * extend its episode. Read by the producer on each slow frame.
+   */
+  void setEpisodeMergeGap(double seconds);
+
+  /**
+   * Frames longer than `seconds` signal the jank listener on the first
+   * such frame of a run; 0 = only episode starts signal.
+   */
+  void setJankThreshold(double seconds);
+
+  /**
+   * Stutter episodes closed after `cursor` (0 = all retained). Episodes
+   * dropped by reset() don't count as missed.
+   */
+  EpisodesSince getEpisodesSince(uint64_t cursor) const;
+
+  /**
+   * Reset all tracking state. Readers observe the reset immediately;
+   * the producer discards its in-flight window on its next tick.
+   */
   void reset();
 
 private:
-  void recordSample(int fps);
+  // Intervals used for the median vsync estimate (odd, so the median is exact)
+  static constexpr size_t kVsyncWindow = 31;
+  // Intervals observed before the median replaces the target-FPS fallback
+  static constexpr size_t kMinVsyncSamples = 8;
+  // Closed stutter episodes retained for getEpisodesSince()
+  static constexpr size_t kEpisodeCapacity = 128;
+
+  /** Sample ring storage; replaced wholesale by resize(). */
+  struct Ring {
+    explicit Ring(size_t capacity);
+    const size_t capacity;
+    std::unique_ptr<std::atomic<int>[]> slots;
+  };
+
+  /** Raw tick storage; replaced wholesale by setRawTickCapture(). */
+  struct TickRing {
+    explicit TickRing(size_t capacity);
+    const size_t capacity; // 0 = request to turn capture off
+    std::unique_ptr<std::atomic<int64_t>[]> slots;
+    SeqLock lock;
+    std::atomic<uint64_t> next{0};    // sequence number of the next tick
+    std::atomic<uint64_t> first{0};   // oldest tick this ring ever held
+    std::atomic<uint64_t> cleared{0}; // older ticks were dropped by reset() or capture off
+  };
+
+  /** One log entry; fields are relaxed atomics read under episodeLock_. */
+  struct EpisodeSlot {
+    std::atomic<int64_t> startNs{0};
+    std::atomic<int64_t> endNs{0};
+    std::atomic<int64_t> framesSkipped{0};
+    std::atomic<int64_t> worstFrameNs{0};
+    std::atomic<int64_t> slowFrames{0};
+  };
 
-  mutable std::mutex mutex_;
-  size_t maxSamples_;
-  std::vector<int> samples_;
-  size_t writeIndex_ = 0;
-  size_t sampleCount_ = 0;
+  void applyPendingControl();
+  void ingestTick(double timestampSeconds);
+  void recordRawTick(double timestampSeconds);
+  void applyReset(uint32_t epoch);
+  void applyResize();
+  void applyTickCapture();
+  void reclaimRetiredRings();
+  void observeInterval(double interval, int64_t skipped);
+  /** Returns true if this frame opened a new episode. */
+  bool trackEpisode(double timestampSeconds, double interval, int64_t skipped);
+  void closeEpisode();
+  double vsyncPeriod() const;
+  void recordSample(int fps, int64_t dropped);
+  bool isCurrentEpoch() const;
+  uint64_t currentGeneration() const;
 
-  // Per-second accumulation
+  // Producer-owned per-second accumulation (touched only by onFrameTick)
   double windowStart_ = 0.0;
   int frameCount_ = 0;
   bool hasFirstTick_ = false;
+  double lastTickTimestamp_ = 0.0;
+  int64_t windowDropped_ = 0;
+  uint32_t appliedEpoch_ = 0;
 
-  // Stats
+  // Producer-owned vsync estimation
+  std::array<double, kVsyncWindow> recentIntervals_{};
+  std::array<double, kVsyncWindow> sortedIntervals_{}; // the same intervals, ascending
+  std::array<int64_t, kVsyncWindow> recentSkipped_{};
+  size_t recentIntervalCount_ = 0;
+  size_t recentIntervalIndex_ = 0;
+  double measuredVsyncPeriod_ = 0.0;
+
+  // Producer-owned open stutter episode and jank edge state
+  StutterEpisode openEpisode_{};
+  bool episodeOpen_ = false;
+  bool overJankThreshold_ = false;
+  const JankListener onJank_;
+
+  // Producer-owned raw tick capture; null while capture is off
+  TickRing* tickRing_ = nullptr;
+  uint64_t nextTickSequence_ = 0;
+
+  // Rings replaced by the last resize / capture change, freed once
+  // activeReaders_ drains
+  Ring* retiredRing_ = nullptr;
+  TickRing* retiredTickRing_ = nullptr;
+
+  // Published state — written by the producer inside publishLock_,
+  // read by any thread through publishLock_.read().
+  SeqLock publishLock_;
+  std::atomic<Ring*> ring_;
+  mutable std::atomic<int> activeReaders_{0};
+  std::atomic<size_t> writeIndex_{0};
+  std::atomic<size_t> sampleCount_{0};
+  std::atomic<uint32_t> publishedEpoch_{0};
+  std::atomic<uint64_t> generation_{0};
+  std::atomic<uint64_t> nextSequence_{0};  // sequence number of the next sample
+  std::atomic<uint64_t> resetSequence_{0}; // cursors below this predate the last reset
   std::atomic<int> currentFps_{0};
-  int minFps_ = INT32_MAX;
-  int maxFps_ = 0;
-  int64_t droppedFrames_ = 0;
-  int stutterCount_ = 0;
-  int targetFps_ = 60;
+  std::atomic<int> minFps_{INT32_MAX};
+  std::atomic<int> maxFps_{0};
+  std::atomic<int64_t> droppedFrames_{0};
+  std::atomic<int> stutterCount_{0};
+  std::atomic<double> refreshRateHz_{0.0};
+  LatencyHistogram frameTimes_;
+  std::atomic<TickRing*> publishedTickRing_{nullptr};
+
+  // Closed stutter episodes — written by the producer, read by any thread
+  // through episodeLock_.read()
+  SeqLock episodeLock_;
+  std::array<EpisodeSlot, kEpisodeCapacity> episodes_;
+  std::atomic<uint64_t> nextEpisode_{0};    // sequence number of the next episode
+  std::atomic<uint64_t> clearedEpisodes_{0}; // older episodes were dropped by reset()
+
+  // Control state (any thread)
+  std::atomic<uint32_t> resetEpoch_{0};
+  std::atomic<Ring*> pendingRing_{nullptr};
+  std::atomic<size_t> requestedCapacity_;
+  std::atomic<TickRing*> pendingTickRing_{nullptr};
+  std::atomic<size_t> requestedTickCapacity_{0};
+  std::atomic<int> targetFps_{60};
+  std::atomic<int64_t> episodeMergeGapNs_{100'000'000};
+  std::atomic<double> jankThresholdSeconds_{0.0};
 };
 
 } // namespace nitroperf
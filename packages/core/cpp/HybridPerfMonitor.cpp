@@ -1,15 +1,145 @@
 #include "HybridPerfMonitor.hpp"
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <iterator>
+#include <limits>
 
 namespace margelo::nitro::nitroperf {
 
+// PerfSnapshot fields in declaration order; bit i of a subscribeFields()
+// mask selects kSnapshotFields[i]. Keep in sync with PERF_SNAPSHOT_FIELDS
+// in src/snapshotFields.ts.
+static constexpr double PerfSnapshot::* kSnapshotFields[] = {
+  &PerfSnapshot::uiFps,
+  &PerfSnapshot::jsFps,
+  &PerfSnapshot::ramBytes,
+  &PerfSnapshot::jsHeapUsedBytes,
+  &PerfSnapshot::jsHeapTotalBytes,
+  &PerfSnapshot::droppedFrames,
+  &PerfSnapshot::stutterCount,
+  &PerfSnapshot::timestamp,
+  &PerfSnapshot::longTaskCount,
+  &PerfSnapshot::longTaskTotalMs,
+  &PerfSnapshot::slowEventCount,
+  &PerfSnapshot::maxEventDurationMs,
+  &PerfSnapshot::renderCount,
+  &PerfSnapshot::lastRenderDurationMs,
+  &PerfSnapshot::refreshRateHz,
+  &PerfSnapshot::schedulerLatenessMs,
+  &PerfSnapshot::pssBytes,
+  &PerfSnapshot::privateCleanBytes,
+  &PerfSnapshot::privateDirtyBytes,
+  &PerfSnapshot::swapBytes,
+  &PerfSnapshot::anonBytes,
+  &PerfSnapshot::fileBytes,
+  &PerfSnapshot::processCpuPercent,
+  &PerfSnapshot::uiCpuPercent,
+  &PerfSnapshot::jsCpuPercent,
+  &PerfSnapshot::uiRunQueueMsPerSec,
+  &PerfSnapshot::jsRunQueueMsPerSec,
+  &PerfSnapshot::uiPreemptionsPerSec,
+  &PerfSnapshot::jsPreemptionsPerSec,
+  &PerfSnapshot::uiVoluntarySwitchesPerSec,
+  &PerfSnapshot::jsVoluntarySwitchesPerSec,
+  &PerfSnapshot::minorFaultsPerSec,
+  &PerfSnapshot::majorFaultsPerSec,
+};
+static constexpr uint64_t kAllSnapshotFields = (uint64_t{1} << std::size(kSnapshotFields)) - 1;
+
+static constexpr size_t kTimestampIndex = 7;
+static constexpr uint64_t kTimestampBit = uint64_t{1} << kTimestampIndex;
+static_assert(kSnapshotFields[kTimestampIndex] == &PerfSnapshot::timestamp);
+
+// Rows kept by the snapshot store: 30 min at the default 500 ms interval
+static constexpr size_t kStoredSnapshots = 3600;
+
+// Default per-field change thresholds for subscribeChanges(), indexed like
+// kSnapshotFields. Counters and FPS report any change; byte sizes ignore
+// allocator noise, and minor faults the steady trickle every app has.
+// The timestamp always changes, so it never counts.
+static constexpr double kDefaultEpsilons[] = {
+  0.0,                                      // uiFps
+  0.0,                                      // jsFps
+  256.0 * 1024,                             // ramBytes
+  256.0 * 1024,                             // jsHeapUsedBytes
+  256.0 * 1024,                             // jsHeapTotalBytes
+  0.0,                                      // droppedFrames
+  0.0,                                      // stutterCount
+  std::numeric_limits<double>::infinity(),  // timestamp
+  0.0,                                      // longTaskCount
+  0.0,                                      // longTaskTotalMs
+  0.0,                                      // slowEventCount
+  0.0,                                      // maxEventDurationMs
+  0.0,                                      // renderCount
+  0.0,                                      // lastRenderDurationMs
+  0.5,                                      // refreshRateHz
+  2.0,                                      // schedulerLatenessMs
+  256.0 * 1024,                             // pssBytes
+  256.0 * 1024,                             // privateCleanBytes
+  256.0 * 1024,                             // privateDirtyBytes
+  256.0 * 1024,                             // swapBytes
+  256.0 * 1024,                             // anonBytes
+  256.0 * 1024,                             // fileBytes
+  1.0,                                      // processCpuPercent
+  1.0,                                      // uiCpuPercent
+  1.0,                                      // jsCpuPercent
+  1.0,                                      // uiRunQueueMsPerSec
+  1.0,                                      // jsRunQueueMsPerSec
+  1.0,                                      // uiPreemptionsPerSec
+  1.0,                                      // jsPreemptionsPerSec
+  1.0,                                      // uiVoluntarySwitchesPerSec
+  1.0,                                      // jsVoluntarySwitchesPerSec
+  10.0,                                     // minorFaultsPerSec
+  0.0,                                      // majorFaultsPerSec
+};
+static_assert(std::size(kDefaultEpsilons) == std::size(kSnapshotFields));
+
+static uint64_t toFieldMask(double fieldMask) {
+  uint64_t mask = fieldMask > 0 ? static_cast<uint64_t>(fieldMask) & kAllSnapshotFields : 0;
+  return mask == 0 ? kAllSnapshotFields : mask;
+}
+
+// Subscribers due within this window of a wake-up are served by it
+static constexpr auto kCoalesceWindow = std::chrono::milliseconds(8);
+// Floor for per-subscriber cadences (one 60 Hz frame)
+static constexpr auto kMinSubscriberInterval = std::chrono::milliseconds(16);
+
+static std::chrono::milliseconds toSubscriberInterval(double intervalMs) {
+  if (!(intervalMs > 0)) return std::chrono::milliseconds(0); // follow updateIntervalMs
+  return std::max(kMinSubscriberInterval,
+                  std::chrono::milliseconds(static_cast<int64_t>(std::llround(intervalMs))));
+}
+
+/** First point of the grid origin + k * interval strictly after `after`. */
+static std::chrono::steady_clock::time_point nextGridPoint(std::chrono::steady_clock::time_point origin,
+                                                           std::chrono::milliseconds interval,
+                                                           std::chrono::steady_clock::time_point after) {
+  if (after < origin) return origin;
+  auto steps = (after - origin) / interval + 1;
+  return origin + interval * steps;
+}
+
+// Index of each tracker in per-thread arrays, and its name in events
+static constexpr size_t kUiThread = 0;
+static constexpr size_t kJsThread = 1;
+static constexpr const char* kThreadNames[] = {"ui", "js"};
+static constexpr ::nitroperf::ThreadRole kThreadRoles[] = {::nitroperf::ThreadRole::kUi, ::nitroperf::ThreadRole::kJs};
+
 HybridPerfMonitor::HybridPerfMonitor()
     : HybridObject(TAG),
       HybridPerfMonitorSpec(),
-      uiFpsTracker_(std::make_unique<::nitroperf::FPSTracker>(60)),
-      jsFpsTracker_(std::make_unique<::nitroperf::FPSTracker>(60)),
-      platform_(::nitroperf::PlatformMetrics::create()) {}
+      uiFpsTracker_(std::make_unique<::nitroperf::FPSTracker>(60, [this](const auto& onset) {
+        onJankOnset(kUiThread, onset);
+      })),
+      jsFpsTracker_(std::make_unique<::nitroperf::FPSTracker>(60, [this](const auto& onset) {
+        onJankOnset(kJsThread, onset);
+      })),
+      platform_(::nitroperf::PlatformMetrics::create()),
+      snapshotStore_(std::size(kSnapshotFields), kTimestampIndex, kStoredSnapshots) {
+  publishSnapshot();
+}
 
 HybridPerfMonitor::~HybridPerfMonitor() {
   stop();
@@ -23,13 +153,19 @@ void HybridPerfMonitor::start() {
     uiFpsTracker_->onFrameTick(ts);
   });
 
-  // Start platform JS FPS tracking (may be no-op on Android)
-  platform_->startJSFPSTracking([this](double ts) {
-    jsFpsTracker_->onFrameTick(ts);
-  });
+  // JS FPS is fed exclusively by reportJsFrameTick() from the JS rAF loop.
+  // FPSTracker is single-producer, so the platform JS display link (which
+  // would tick on the main run loop) must not feed the same tracker.
+
+  publishSnapshot();
 
   // Start notification timer
-  timerRunning_.store(true);
+  {
+    std::lock_guard<std::mutex> lock(timerMutex_);
+    timerRunning_.store(true);
+    timerRescheduled_ = false;
+    jankPending_ = false;
+  }
   timerThread_ = std::thread(&HybridPerfMonitor::timerLoop, this);
 }
 
@@ -37,13 +173,18 @@ void HybridPerfMonitor::stop() {
   if (!isRunning_.exchange(false)) return; // Already stopped
 
   platform_->stopUIFPSTracking();
-  platform_->stopJSFPSTracking();
 
-  // Stop timer thread
-  timerRunning_.store(false);
+  // Stop timer thread — wakes it immediately instead of waiting out the interval
+  {
+    std::lock_guard<std::mutex> lock(timerMutex_);
+    timerRunning_.store(false);
+  }
+  timerCv_.notify_all();
   if (timerThread_.joinable()) {
     timerThread_.join();
   }
+
+  publishSnapshot();
 }
 
 bool HybridPerfMonitor::getIsRunning() {
@@ -51,27 +192,70 @@ bool HybridPerfMonitor::getIsRunning() {
 }
 
 PerfSnapshot HybridPerfMonitor::getMetrics() {
-  return PerfSnapshot(
-    static_cast<double>(uiFpsTracker_->getCurrentFps()),
-    static_cast<double>(jsFpsTracker_->getCurrentFps()),
+  // While stopped nothing refreshes the published snapshot, so compose
+  // one on demand; the running path is a single lock-free copy.
+  if (!isRunning_.load(std::memory_order_relaxed)) {
+    return publishSnapshot();
+  }
+  return snapshot_.load();
+}
+
+PerfSnapshot HybridPerfMonitor::publishSnapshot() {
+  std::lock_guard<std::mutex> lock(publishMutex_);
+  return publishSnapshotLocked();
+}
+
+PerfSnapshot HybridPerfMonitor::publishSnapshotLocked() {
+  auto ui = uiFpsTracker_->getStats();
+  auto js = jsFpsTracker_->getStats();
+  auto memory = memoryBreakdown_.load();
+  auto cpu = cpuSummary_.load();
+  auto counters = counterRates_.load();
+
+  PerfSnapshot snapshot(
+    static_cast<double>(ui.currentFps),
+    static_cast<double>(js.currentFps),
     static_cast<double>(platform_->getResidentMemoryBytes()),
     static_cast<double>(jsHeapUsed_.load(std::memory_order_relaxed)),
     static_cast<double>(jsHeapTotal_.load(std::memory_order_relaxed)),
-    static_cast<double>(uiFpsTracker_->getDroppedFrames() + jsFpsTracker_->getDroppedFrames()),
-    static_cast<double>(uiFpsTracker_->getStutterCount() + jsFpsTracker_->getStutterCount()),
+    static_cast<double>(ui.droppedFrames + js.droppedFrames),
+    static_cast<double>(ui.stutterCount + js.stutterCount),
     getCurrentTimestamp(),
     static_cast<double>(longTaskCount_.load(std::memory_order_relaxed)),
-    static_cast<double>(longTaskTotalMs_.load(std::memory_order_relaxed)),
+    static_cast<double>(longTaskDurations_.sumUs()) / 1000.0,
     static_cast<double>(slowEventCount_.load(std::memory_order_relaxed)),
     maxEventDurationMs_.load(std::memory_order_relaxed),
     static_cast<double>(renderCount_.load(std::memory_order_relaxed)),
-    lastRenderDurationMs_.load(std::memory_order_relaxed)
+    lastRenderDurationMs_.load(std::memory_order_relaxed),
+    ui.refreshRateHz,
+    schedulerLatenessMs_.load(std::memory_order_relaxed),
+    static_cast<double>(memory.pssBytes),
+    static_cast<double>(memory.privateCleanBytes),
+    static_cast<double>(memory.privateDirtyBytes),
+    static_cast<double>(memory.swapBytes),
+    static_cast<double>(memory.anonBytes),
+    static_cast<double>(memory.fileBytes),
+    cpu.process,
+    cpu.ui,
+    cpu.js,
+    counters.runQueueMsPerSec[kUiThread],
+    counters.runQueueMsPerSec[kJsThread],
+    counters.preemptionsPerSec[kUiThread],
+    counters.preemptionsPerSec[kJsThread],
+    counters.voluntarySwitchesPerSec[kUiThread],
+    counters.voluntarySwitchesPerSec[kJsThread],
+    counters.minorFaultsPerSec,
+    counters.majorFaultsPerSec
   );
+  snapshot_.store(snapshot);
+  return snapshot;
 }
 
 FPSHistory HybridPerfMonitor::getHistory() {
   auto uiSamples = uiFpsTracker_->getSamples();
   auto jsSamples = jsFpsTracker_->getSamples();
+  auto uiStats = uiFpsTracker_->getStats();
+  auto jsStats = jsFpsTracker_->getStats();
 
   std::vector<double> uiDoubleSamples;
   uiDoubleSamples.reserve(uiSamples.size());
@@ -88,38 +272,510 @@ FPSHistory HybridPerfMonitor::getHistory() {
   return FPSHistory(
     std::move(uiDoubleSamples),
     std::move(jsDoubleSamples),
-    static_cast<double>(uiFpsTracker_->getMinFps()),
-    static_cast<double>(uiFpsTracker_->getMaxFps()),
-    static_cast<double>(jsFpsTracker_->getMinFps()),
-    static_cast<double>(jsFpsTracker_->getMaxFps())
+    static_cast<double>(uiStats.minFps),
+    static_cast<double>(uiStats.maxFps),
+    static_cast<double>(jsStats.minFps),
+    static_cast<double>(jsStats.maxFps)
+  );
+}
+
+static std::vector<double> toDoubleSamples(const std::vector<int>& samples) {
+  return std::vector<double>(samples.begin(), samples.end());
+}
+
+static uint64_t toCursor(double value) {
+  return value > 0 ? static_cast<uint64_t>(value) : uint64_t{0};
+}
+
+FPSHistoryDelta HybridPerfMonitor::getHistorySince(const HistoryCursor& cursor) {
+  auto ui = uiFpsTracker_->getSamplesSince(toCursor(cursor.ui));
+  auto js = jsFpsTracker_->getSamplesSince(toCursor(cursor.js));
+  auto uiStats = uiFpsTracker_->getStats();
+  auto jsStats = jsFpsTracker_->getStats();
+
+  return FPSHistoryDelta(
+    toDoubleSamples(ui.samples),
+    toDoubleSamples(js.samples),
+    static_cast<double>(ui.missed),
+    static_cast<double>(js.missed),
+    ui.reset,
+    js.reset,
+    HistoryCursor(static_cast<double>(ui.cursor), static_cast<double>(js.cursor)),
+    static_cast<double>(uiStats.minFps),
+    static_cast<double>(uiStats.maxFps),
+    static_cast<double>(jsStats.minFps),
+    static_cast<double>(jsStats.maxFps)
+  );
+}
+
+static RollupStats toRollupStats(const ::nitroperf::MetricRollup::Series& series,
+                                ::nitroperf::MetricRollup::Metric metric) {
+  return RollupStats(series.min[metric], series.max[metric], series.mean[metric]);
+}
+
+MetricRollups HybridPerfMonitor::getRollups(double fromMs, double toMs, double maxPoints) {
+  using Rollup = ::nitroperf::MetricRollup;
+  auto series = rollups_.query(static_cast<int64_t>(fromMs), static_cast<int64_t>(toMs),
+                               maxPoints > 0 ? static_cast<size_t>(maxPoints) : 1);
+
+  return MetricRollups(
+    static_cast<double>(series.resolutionMs),
+    std::vector<double>(series.startMs.begin(), series.startMs.end()),
+    std::vector<double>(series.counts.begin(), series.counts.end()),
+    toRollupStats(series, Rollup::kUiFps),
+    toRollupStats(series, Rollup::kJsFps),
+    toRollupStats(series, Rollup::kRamBytes),
+    toRollupStats(series, Rollup::kJsHeapUsedBytes),
+    toRollupStats(series, Rollup::kDroppedFrames)
+  );
+}
+
+SnapshotSeries HybridPerfMonitor::getSnapshotRange(double fromMs, double toMs,
+                                                  double fieldMask, double maxRows) {
+  uint64_t mask = toFieldMask(fieldMask) & ~kTimestampBit;
+  auto range = snapshotStore_.query(fromMs, toMs, mask, maxRows > 0 ? static_cast<size_t>(maxRows) : 0);
+
+  auto toBuffer = [](const std::vector<double>& column) {
+    return ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(column.data()), column.size() * sizeof(double));
+  };
+  return SnapshotSeries(
+    static_cast<double>(mask),
+    static_cast<double>(range.rows),
+    toBuffer(range.timestamps),
+    toBuffer(range.values)
+  );
+}
+
+double HybridPerfMonitor::getHistoryGeneration() {
+  // Both components are monotonic, so the sum changes whenever either does
+  return static_cast<double>(uiFpsTracker_->getGeneration() + jsFpsTracker_->getGeneration());
+}
+
+FPSHistoryBuffer HybridPerfMonitor::getHistoryBuffer() {
+  std::shared_ptr<ArrayBuffer> ui, js;
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(historyBufferMutex_);
+    ui = cachedHistoryBuffer(*uiFpsTracker_, uiHistoryBuffer_);
+    js = cachedHistoryBuffer(*jsFpsTracker_, jsHistoryBuffer_);
+    generation = uiHistoryBuffer_.generation + jsHistoryBuffer_.generation;
+  }
+  auto uiStats = uiFpsTracker_->getStats();
+  auto jsStats = jsFpsTracker_->getStats();
+
+  return FPSHistoryBuffer(
+    std::move(ui),
+    std::move(js),
+    static_cast<double>(uiStats.minFps),
+    static_cast<double>(uiStats.maxFps),
+    static_cast<double>(jsStats.minFps),
+    static_cast<double>(jsStats.maxFps),
+    static_cast<double>(generation)
+  );
+}
+
+std::shared_ptr<ArrayBuffer> HybridPerfMonitor::cachedHistoryBuffer(const ::nitroperf::FPSTracker& tracker,
+                                                                    HistoryBufferCache& cache) {
+  if (cache.buffer && tracker.getGeneration() == cache.generation) {
+    return cache.buffer;
+  }
+
+  // Never written after publication: JS views it directly (no element
+  // conversion) and an older buffer stays valid for as long as JS holds it.
+  uint64_t generation = 0;
+  std::vector<int> samples = tracker.getSamples(&generation);
+  static_assert(sizeof(int) == sizeof(int32_t));
+  cache.buffer = ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(samples.data()),
+                                   samples.size() * sizeof(int32_t));
+  cache.generation = generation;
+  return cache.buffer;
+}
+
+static FrameTimeStats toFrameTimeStats(const ::nitroperf::LatencyHistogram::Snapshot& histogram) {
+  constexpr double kUsToMs = 1.0 / 1000.0;
+  return FrameTimeStats(
+    static_cast<double>(histogram.count),
+    histogram.mean() * kUsToMs,
+    histogram.percentile(0.50) * kUsToMs,
+    histogram.percentile(0.90) * kUsToMs,
+    histogram.percentile(0.99) * kUsToMs,
+    histogram.percentile(0.999) * kUsToMs,
+    static_cast<double>(histogram.maxUs) * kUsToMs
+  );
+}
+
+static DurationDistribution toDurationDistribution(const ::nitroperf::LatencyHistogram::Snapshot& histogram) {
+  using Histogram = ::nitroperf::LatencyHistogram;
+  constexpr double kUsToMs = 1.0 / 1000.0;
+
+  // Only non-empty buckets cross to JS
+  std::vector<double> starts, widths, counts;
+  for (size_t i = 0; i < Histogram::kBucketCount; i++) {
+    if (histogram.counts[i] == 0) continue;
+    starts.push_back(static_cast<double>(Histogram::bucketLowerBound(i)) * kUsToMs);
+    widths.push_back(static_cast<double>(Histogram::bucketWidth(i)) * kUsToMs);
+    counts.push_back(static_cast<double>(histogram.counts[i]));
+  }
+
+  return DurationDistribution(
+    static_cast<double>(histogram.count),
+    static_cast<double>(histogram.sumUs) * kUsToMs,
+    histogram.mean() * kUsToMs,
+    histogram.percentile(0.50) * kUsToMs,
+    histogram.percentile(0.90) * kUsToMs,
+    histogram.percentile(0.95) * kUsToMs,
+    histogram.percentile(0.99) * kUsToMs,
+    static_cast<double>(histogram.maxUs) * kUsToMs,
+    std::move(starts),
+    std::move(widths),
+    std::move(counts)
+  );
+}
+
+static DistributionSet toDistributionSet(const std::array<::nitroperf::LatencyHistogram::Snapshot, 3>& histograms) {
+  return DistributionSet(
+    toDurationDistribution(histograms[0]),
+    toDurationDistribution(histograms[1]),
+    toDurationDistribution(histograms[2])
+  );
+}
+
+std::array<::nitroperf::LatencyHistogram::Snapshot, 3> HybridPerfMonitor::captureDistributions() const {
+  return {longTaskDurations_.snapshot(), slowEventDurations_.snapshot(), renderDurations_.snapshot()};
+}
+
+void HybridPerfMonitor::rollDistributionInterval() {
+  auto now = std::chrono::steady_clock::now();
+  auto current = captureDistributions();
+
+  std::lock_guard<std::mutex> lock(distributionMutex_);
+  DistributionIntervals& state = distributionIntervals_;
+  for (size_t i = 0; i < current.size(); i++) {
+    state.interval[i] = current[i].since(state.baseline[i]);
+  }
+  state.baseline = current;
+  state.intervalMs = state.rolledAt == std::chrono::steady_clock::time_point{}
+      ? 0.0
+      : std::chrono::duration<double, std::milli>(now - state.rolledAt).count();
+  state.rolledAt = now;
+}
+
+Distributions HybridPerfMonitor::getDistributions() {
+  auto total = captureDistributions();
+  std::array<::nitroperf::LatencyHistogram::Snapshot, 3> interval;
+  double intervalMs;
+  {
+    std::lock_guard<std::mutex> lock(distributionMutex_);
+    interval = distributionIntervals_.interval;
+    intervalMs = distributionIntervals_.intervalMs;
+  }
+  return Distributions(toDistributionSet(total), toDistributionSet(interval), intervalMs);
+}
+
+static constexpr const char* kThreadRoleNames[] = {"other", "ui", "js", "monitor"};
+
+ThreadCpuUsage HybridPerfMonitor::getThreadCpuUsage() {
+  std::lock_guard<std::mutex> lock(cpuUsageMutex_);
+
+  std::vector<const ::nitroperf::ThreadCpu*> sorted;
+  sorted.reserve(cpuUsage_.threads.size());
+  for (const auto& thread : cpuUsage_.threads) {
+    sorted.push_back(&thread);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+    return a->cpuPercent > b->cpuPercent;
+  });
+
+  std::vector<ThreadCpuStats> threads;
+  threads.reserve(sorted.size());
+  for (const auto* thread : sorted) {
+    threads.emplace_back(
+      static_cast<double>(thread->tid),
+      std::string(thread->name),
+      kThreadRoleNames[static_cast<size_t>(thread->role)],
+      std::string(1, thread->state),
+      static_cast<double>(thread->lastCpu),
+      thread->cpuPercent
+    );
+  }
+  return ThreadCpuUsage(cpuUsage_.intervalMs, cpuUsage_.processPercent, std::move(threads));
+}
+
+void HybridPerfMonitor::sampleCountersLocked(bool updateRates) {
+  CounterRates rates{};
+  countersSampledNs_ = ::nitroperf::Timebase::nowNs();
+
+  for (size_t thread = 0; thread < schedTimelines_.size(); thread++) {
+    ::nitroperf::ThreadSchedStats stats;
+    if (!platform_->getThreadSchedStats(kThreadRoles[thread], stats)) continue;
+    int64_t nowNs = ::nitroperf::Timebase::nowNs();
+    schedTimelines_[thread].record(nowNs, stats.tid, {stats.runNs, stats.runQueueNs});
+    if (!updateRates) continue;
+
+    // Rates need a baseline from the same thread
+    const auto& base = schedRateBase_[thread];
+    int64_t baseNs = schedRateBaseNs_[thread];
+    if (baseNs != 0 && base.tid == stats.tid && nowNs > baseNs) {
+      double seconds = static_cast<double>(nowNs - baseNs) / 1e9;
+      rates.runQueueMsPerSec[thread] = static_cast<double>(stats.runQueueNs - base.runQueueNs) / 1e6 / seconds;
+      rates.preemptionsPerSec[thread] =
+          static_cast<double>(stats.involuntarySwitches - base.involuntarySwitches) / seconds;
+      rates.voluntarySwitchesPerSec[thread] =
+          static_cast<double>(stats.voluntarySwitches - base.voluntarySwitches) / seconds;
+    }
+    schedRateBase_[thread] = stats;
+    schedRateBaseNs_[thread] = nowNs;
+  }
+
+  ::nitroperf::PageFaults faults;
+  if (platform_->getPageFaults(faults)) {
+    int64_t nowNs = ::nitroperf::Timebase::nowNs();
+    faultTimeline_.record(nowNs, 0, {static_cast<int64_t>(faults.minor), static_cast<int64_t>(faults.major)});
+    if (updateRates) {
+      // A counter that went backwards wrapped; skip that interval
+      const auto& base = faultRateBase_;
+      if (faultRateBaseNs_ != 0 && nowNs > faultRateBaseNs_ &&
+          faults.minor >= base.minor && faults.major >= base.major) {
+        double seconds = static_cast<double>(nowNs - faultRateBaseNs_) / 1e9;
+        rates.minorFaultsPerSec = static_cast<double>(faults.minor - base.minor) / seconds;
+        rates.majorFaultsPerSec = static_cast<double>(faults.major - base.major) / seconds;
+      }
+      faultRateBase_ = faults;
+      faultRateBaseNs_ = nowNs;
+    }
+  }
+  if (updateRates) counterRates_.store(rates);
+}
+
+void HybridPerfMonitor::sampleCpuUsage() {
+  if (!platform_->sampleCpuUsage(cpuUsageScratch_)) return;
+
+  CpuSummary summary{cpuUsageScratch_.processPercent, 0.0, 0.0};
+  for (const auto& thread : cpuUsageScratch_.threads) {
+    if (thread.role == ::nitroperf::ThreadRole::kUi) summary.ui = thread.cpuPercent;
+    if (thread.role == ::nitroperf::ThreadRole::kJs) summary.js = thread.cpuPercent;
+  }
+  cpuSummary_.store(summary);
+
+  // Swapping keeps both buffers' capacity, so steady state doesn't allocate
+  std::lock_guard<std::mutex> lock(cpuUsageMutex_);
+  std::swap(cpuUsage_, cpuUsageScratch_);
+}
+
+FrameTimePercentiles HybridPerfMonitor::getFrameTimePercentiles() {
+  return FrameTimePercentiles(
+    toFrameTimeStats(uiFpsTracker_->getFrameTimeHistogram()),
+    toFrameTimeStats(jsFpsTracker_->getFrameTimeHistogram())
+  );
+}
+
+// Upper bound for raw frame capture per thread: ~9 min at 120 Hz, 512 KB
+static constexpr size_t kMaxRawFrameCapacity = 65536;
+
+void HybridPerfMonitor::setRawFrameCapture(double capacity) {
+  size_t ticks = capacity > 0
+      ? std::min(static_cast<size_t>(capacity), kMaxRawFrameCapacity)
+      : 0;
+  uiFpsTracker_->setRawTickCapture(ticks);
+  jsFpsTracker_->setRawTickCapture(ticks);
+}
+
+static std::shared_ptr<ArrayBuffer> toTimestampBuffer(const std::vector<int64_t>& timestampsNs) {
+  return ArrayBuffer::copy(reinterpret_cast<const uint8_t*>(timestampsNs.data()),
+                           timestampsNs.size() * sizeof(int64_t));
+}
+
+RawFrameTimestamps HybridPerfMonitor::getRawFramesSince(const HistoryCursor& cursor) {
+  auto ui = uiFpsTracker_->getRawTicksSince(toCursor(cursor.ui));
+  auto js = jsFpsTracker_->getRawTicksSince(toCursor(cursor.js));
+
+  return RawFrameTimestamps(
+    toTimestampBuffer(ui.timestampsNs),
+    toTimestampBuffer(js.timestampsNs),
+    static_cast<double>(ui.missed),
+    static_cast<double>(js.missed),
+    HistoryCursor(static_cast<double>(ui.cursor), static_cast<double>(js.cursor))
+  );
+}
+
+std::vector<StutterEpisode> HybridPerfMonitor::toStutterEpisodes(
+    const ::nitroperf::FPSTracker::EpisodesSince& ui,
+    const ::nitroperf::FPSTracker::EpisodesSince& js) {
+  constexpr double kNsToMs = 1.0 / 1e6;
+  std::lock_guard<std::mutex> lock(counterMutex_);
+
+  // Credit each episode its thread's scheduler time and the process's
+  // page faults; sample again first if an episode (they're in order)
+  // ends after the newest sample
+  auto endsAfterSample = [this](const ::nitroperf::FPSTracker::EpisodesSince& source) {
+    return !source.episodes.empty() && source.episodes.back().endNs > countersSampledNs_;
+  };
+  if (endsAfterSample(ui) || endsAfterSample(js)) {
+    sampleCountersLocked(false);
+  }
+
+  std::vector<StutterEpisode> result;
+  result.reserve(ui.episodes.size() + js.episodes.size());
+  auto append = [&](const ::nitroperf::FPSTracker::EpisodesSince& source, size_t thread) {
+    for (const auto& episode : source.episodes) {
+      auto [runningNs, runQueueNs] = schedTimelines_[thread].between(episode.startNs, episode.endNs);
+      auto [minorFaults, majorFaults] = faultTimeline_.between(episode.startNs, episode.endNs);
+      result.emplace_back(
+        kThreadNames[thread],
+        timebase_.toWallMs(episode.startNs),
+        timebase_.toWallMs(episode.endNs),
+        static_cast<double>(episode.endNs - episode.startNs) * kNsToMs,
+        static_cast<double>(episode.framesSkipped),
+        static_cast<double>(episode.worstFrameNs) * kNsToMs,
+        static_cast<double>(episode.slowFrames),
+        static_cast<double>(runningNs) * kNsToMs,
+        static_cast<double>(runQueueNs) * kNsToMs,
+        static_cast<double>(minorFaults),
+        static_cast<double>(majorFaults)
+      );
+    }
+  };
+  append(ui, kUiThread);
+  append(js, kJsThread);
+  std::stable_sort(result.begin(), result.end(), [](const StutterEpisode& a, const StutterEpisode& b) {
+    return a.startMs < b.startMs;
+  });
+  return result;
+}
+
+StutterEpisodes HybridPerfMonitor::getStutterEpisodesSince(const HistoryCursor& cursor) {
+  auto ui = uiFpsTracker_->getEpisodesSince(toCursor(cursor.ui));
+  auto js = jsFpsTracker_->getEpisodesSince(toCursor(cursor.js));
+
+  return StutterEpisodes(
+    toStutterEpisodes(ui, js),
+    static_cast<double>(ui.missed),
+    static_cast<double>(js.missed),
+    HistoryCursor(static_cast<double>(ui.cursor), static_cast<double>(js.cursor))
   );
 }
 
-double HybridPerfMonitor::subscribe(const std::function<void(const PerfSnapshot&)>& cb) {
+double HybridPerfMonitor::subscribe(const std::function<void(const PerfSnapshot&)>& cb,
+                                    const std::optional<double>& intervalMs) {
+  Subscriber subscriber;
+  subscriber.interval = toSubscriberInterval(intervalMs.value_or(0.0));
+  subscriber.callback = cb;
+  return addSubscriber(std::move(subscriber));
+}
+
+double HybridPerfMonitor::subscribeFields(double fieldMask, double intervalMs,
+                                          const std::function<void(const std::vector<double>&)>& cb) {
+  Subscriber subscriber;
+  subscriber.interval = toSubscriberInterval(intervalMs);
+  subscriber.fieldMask = toFieldMask(fieldMask);
+  subscriber.valuesCallback = cb;
+  return addSubscriber(std::move(subscriber));
+}
+
+double HybridPerfMonitor::subscribeChanges(double fieldMask, double intervalMs, double heartbeatMs,
+                                           const std::vector<double>& epsilons,
+                                           const std::function<void(double, const std::vector<double>&)>& cb) {
+  Subscriber subscriber;
+  subscriber.interval = toSubscriberInterval(intervalMs);
+  subscriber.fieldMask = toFieldMask(fieldMask);
+  subscriber.changesCallback = cb;
+  if (heartbeatMs > 0) {
+    subscriber.heartbeat = std::chrono::milliseconds(static_cast<int64_t>(std::llround(heartbeatMs)));
+  }
+  // Negative or missing entries keep the default threshold for that field
+  subscriber.epsilons.assign(std::begin(kDefaultEpsilons), std::end(kDefaultEpsilons));
+  for (size_t i = 0; i < std::min(epsilons.size(), subscriber.epsilons.size()); i++) {
+    if (epsilons[i] >= 0) subscriber.epsilons[i] = epsilons[i];
+  }
+  return addSubscriber(std::move(subscriber));
+}
+
+double HybridPerfMonitor::subscribeStutters(const std::function<void(const std::vector<StutterEpisode>&)>& cb) {
+  Subscriber subscriber;
+  subscriber.stuttersCallback = cb;
+  return addSubscriber(std::move(subscriber));
+}
+
+double HybridPerfMonitor::subscribeJank(const std::function<void(const JankEvent&)>& cb) {
+  Subscriber subscriber;
+  subscriber.jankCallback = cb;
+  // Producers skip signalling entirely while nobody listens
+  jankSubscriberCount_.fetch_add(1, std::memory_order_relaxed);
+  return addSubscriber(std::move(subscriber));
+}
+
+double HybridPerfMonitor::addSubscriber(Subscriber subscriber) {
   double id = static_cast<double>(nextSubscriberId_.fetch_add(1));
-  std::lock_guard<std::mutex> lock(subscriberMutex_);
-  subscribers_[id] = cb;
+  subscriber.id = id;
+  subscriber.delivery = std::make_shared<DeliveryState>();
+  if (subscriber.stuttersCallback || subscriber.jankCallback) {
+    // Never due on a cadence; deliverStutters() / deliverJank() serve it
+    subscriber.delivery->nextDue = std::chrono::steady_clock::time_point::max();
+  }
+  subscriber.delivery->lastValues.assign(std::size(kSnapshotFields), std::nan(""));
+  subscribers_.update([&](auto& list) {
+    list.push_back(std::move(subscriber));
+  });
+  // A new subscriber is due immediately and may be faster than the
+  // current deadline
+  wakeTimer();
   return id;
 }
 
 void HybridPerfMonitor::unsubscribe(double id) {
-  std::lock_guard<std::mutex> lock(subscriberMutex_);
-  subscribers_.erase(id);
+  subscribers_.update([this, id](auto& list) {
+    std::erase_if(list, [this, id](const Subscriber& s) {
+      if (s.id != id) return false;
+      if (s.jankCallback) jankSubscriberCount_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    });
+  });
 }
 
 void HybridPerfMonitor::reportJsFrameTick(double ts) {
-  // Convert ms to seconds for FPSTracker
-  double timestampSeconds = ts / 1000.0;
+  // performance.now() ms -> monotonic seconds, so JS and UI frames share
+  // one timebase
+  double timestampSeconds = (ts + timebase_.jsOffsetMs()) / 1000.0;
   jsFpsTracker_->onFrameTick(timestampSeconds);
+  platform_->markCurrentThread(::nitroperf::ThreadRole::kJs);
+}
+
+void HybridPerfMonitor::reportJsFrameTicks(const std::shared_ptr<ArrayBuffer>& timestamps, double count) {
+  // Float64 performance.now() values (ms), oldest first. The buffer is
+  // reused by JS, so only the first `count` entries are meaningful.
+  if (!timestamps || !(count > 0)) return;
+  size_t capacity = timestamps->size() / sizeof(double);
+  size_t n = std::min(static_cast<size_t>(count), capacity);
+  jsFpsTracker_->onFrameTicks(reinterpret_cast<const double*>(timestamps->data()), n, 1.0 / 1000.0,
+                              timebase_.jsOffsetMs() / 1000.0);
+  platform_->markCurrentThread(::nitroperf::ThreadRole::kJs);
+}
+
+void HybridPerfMonitor::calibrateJsClock(double performanceNowMs) {
+  timebase_.calibrateJs(performanceNowMs);
+}
+
+ClockMapping HybridPerfMonitor::getClockMapping() {
+  return ClockMapping(
+    static_cast<double>(::nitroperf::Timebase::nowNs()),
+    timebase_.wallOffsetMs(),
+    timebase_.jsOffsetMs(),
+    timebase_.isJsCalibrated()
+  );
+}
+
+static uint64_t toDurationUs(double durationMs) {
+  return durationMs > 0 ? static_cast<uint64_t>(std::llround(durationMs * 1000.0)) : 0;
 }
 
 void HybridPerfMonitor::reportLongTask(double durationMs) {
   longTaskCount_.fetch_add(1, std::memory_order_relaxed);
-  longTaskTotalMs_.fetch_add(static_cast<int64_t>(durationMs), std::memory_order_relaxed);
+  longTaskDurations_.record(toDurationUs(durationMs));
 }
 
 void HybridPerfMonitor::reportSlowEvent(double durationMs) {
   slowEventCount_.fetch_add(1, std::memory_order_relaxed);
+  slowEventDurations_.record(toDurationUs(durationMs));
   // CAS loop to update max event duration
   double current = maxEventDurationMs_.load(std::memory_order_relaxed);
   while (durationMs > current) {
@@ -132,6 +788,50 @@ void HybridPerfMonitor::reportSlowEvent(double durationMs) {
 void HybridPerfMonitor::reportRender(double actualDurationMs) {
   renderCount_.fetch_add(1, std::memory_order_relaxed);
   lastRenderDurationMs_.store(actualDurationMs, std::memory_order_relaxed);
+  renderDurations_.record(toDurationUs(actualDurationMs));
+}
+
+double HybridPerfMonitor::registerComponent(const std::string& name) {
+  return static_cast<double>(componentRenders_.intern(name));
+}
+
+void HybridPerfMonitor::reportComponentRender(double componentId, double phase, double actualDurationMs) {
+  reportRender(actualDurationMs);
+  if (!(componentId >= 0) || !(phase >= 0)) return;
+  componentRenders_.record(static_cast<uint32_t>(componentId),
+                           static_cast<::nitroperf::ComponentRenderTracker::Phase>(static_cast<uint32_t>(phase)),
+                           actualDurationMs);
+}
+
+std::vector<ComponentRenderStats> HybridPerfMonitor::getComponentRenderStats(double maxCount) {
+  // maxCount <= 0 asks for every tracked component
+  auto top = componentRenders_.top(maxCount > 0 ? static_cast<size_t>(maxCount) : std::numeric_limits<size_t>::max());
+
+  std::vector<ComponentRenderStats> result;
+  result.reserve(top.size());
+  for (auto& stats : top) {
+    double renders = static_cast<double>(stats.renderCount);
+    // Duration totals only cover renders since the component took its
+    // counter, i.e. renderCount - countError of them
+    double measured = renders - static_cast<double>(stats.countError);
+    result.emplace_back(
+      std::move(stats.componentId),
+      renders,
+      static_cast<double>(stats.countError),
+      stats.totalDurationMs,
+      measured > 0 ? stats.totalDurationMs / measured : 0.0,
+      stats.maxDurationMs,
+      stats.lastDurationMs,
+      static_cast<double>(stats.mountCount),
+      static_cast<double>(stats.updateCount),
+      static_cast<double>(stats.nestedUpdateCount)
+    );
+  }
+  return result;
+}
+
+void HybridPerfMonitor::resetComponentRenderStats() {
+  componentRenders_.clear();
 }
 
 void HybridPerfMonitor::reportJsHeap(double usedBytes, double totalBytes) {
@@ -140,59 +840,350 @@ void HybridPerfMonitor::reportJsHeap(double usedBytes, double totalBytes) {
 }
 
 void HybridPerfMonitor::configure(const PerfConfig& config) {
-  updateIntervalMs_.store(static_cast<int>(config.updateIntervalMs));
+  // Applied live: trackers keep their history and the frame callbacks
+  // keep ticking into the same objects.
+  if (config.updateIntervalMs > 0) {
+    int intervalMs = static_cast<int>(config.updateIntervalMs);
+    if (updateIntervalMs_.exchange(intervalMs) != intervalMs) {
+      wakeTimer();
+    }
+  }
 
   if (config.maxHistorySamples > 0) {
     size_t maxSamples = static_cast<size_t>(config.maxHistorySamples);
-    uiFpsTracker_ = std::make_unique<::nitroperf::FPSTracker>(maxSamples);
-    jsFpsTracker_ = std::make_unique<::nitroperf::FPSTracker>(maxSamples);
+    uiFpsTracker_->resize(maxSamples);
+    jsFpsTracker_->resize(maxSamples);
   }
 
   if (config.targetFps > 0) {
-    targetFps_ = static_cast<int>(config.targetFps);
-    uiFpsTracker_->setTargetFps(targetFps_);
-    jsFpsTracker_->setTargetFps(targetFps_);
+    int targetFps = static_cast<int>(config.targetFps);
+    uiFpsTracker_->setTargetFps(targetFps);
+    jsFpsTracker_->setTargetFps(targetFps);
+  }
+
+  if (config.stutterMergeGapMs.has_value() && *config.stutterMergeGapMs >= 0) {
+    double mergeGapSeconds = *config.stutterMergeGapMs / 1000.0;
+    uiFpsTracker_->setEpisodeMergeGap(mergeGapSeconds);
+    jsFpsTracker_->setEpisodeMergeGap(mergeGapSeconds);
+  }
+
+  if (config.jankThresholdMs.has_value() && *config.jankThresholdMs >= 0) {
+    double thresholdSeconds = *config.jankThresholdMs / 1000.0;
+    uiFpsTracker_->setJankThreshold(thresholdSeconds);
+    jsFpsTracker_->setJankThreshold(thresholdSeconds);
+  }
+
+  if (config.memoryBreakdownIntervalMs.has_value() && *config.memoryBreakdownIntervalMs >= 0) {
+    memoryBreakdownIntervalMs_.store(static_cast<int>(*config.memoryBreakdownIntervalMs));
   }
 }
 
 void HybridPerfMonitor::reset() {
+  // Hold the publish lock across the reset so the timer thread can't
+  // publish a snapshot mixing pre- and post-reset values.
+  std::lock_guard<std::mutex> lock(publishMutex_);
   uiFpsTracker_->reset();
   jsFpsTracker_->reset();
   jsHeapUsed_.store(0);
   jsHeapTotal_.store(0);
   longTaskCount_.store(0);
-  longTaskTotalMs_.store(0);
+  longTaskDurations_.clear();
+  slowEventDurations_.clear();
+  renderDurations_.clear();
+  componentRenders_.clear();
+  {
+    std::lock_guard<std::mutex> distributionLock(distributionMutex_);
+    distributionIntervals_ = DistributionIntervals{};
+  }
   slowEventCount_.store(0);
   maxEventDurationMs_.store(0.0);
   renderCount_.store(0);
   lastRenderDurationMs_.store(0.0);
+  rollups_.clear();
+  lastRollupDroppedFrames_ = 0.0;
+  snapshotStore_.clear();
+  publishSnapshotLocked();
 }
 
-void HybridPerfMonitor::notifySubscribers() {
-  PerfSnapshot snapshot = getMetrics();
+void HybridPerfMonitor::recordHistory(const PerfSnapshot& snapshot) {
+  std::array<double, std::size(kSnapshotFields)> row;
+  for (size_t i = 0; i < row.size(); i++) {
+    row[i] = snapshot.*kSnapshotFields[i];
+  }
+  snapshotStore_.append(row.data());
+  rollDistributionInterval();
+
+  // droppedFrames is cumulative; roll up the drops since the previous
+  // publish. reset() zeroes the baseline along with the trackers.
+  double dropped = std::max(0.0, snapshot.droppedFrames - lastRollupDroppedFrames_);
+  lastRollupDroppedFrames_ = snapshot.droppedFrames;
 
-  std::lock_guard<std::mutex> lock(subscriberMutex_);
-  for (auto& [id, callback] : subscribers_) {
-    callback(snapshot);
+  rollups_.record(static_cast<int64_t>(snapshot.timestamp), {
+    snapshot.uiFps,
+    snapshot.jsFps,
+    snapshot.ramBytes,
+    snapshot.jsHeapUsedBytes,
+    dropped,
+  });
+}
+
+void HybridPerfMonitor::wakeTimer() {
+  {
+    std::lock_guard<std::mutex> lock(timerMutex_);
+    timerRescheduled_ = true;
   }
+  timerCv_.notify_all();
 }
 
 void HybridPerfMonitor::timerLoop() {
+  using Clock = std::chrono::steady_clock;
+
+  // Every cadence runs on a grid anchored at `origin`, so subscribers whose
+  // intervals are multiples of each other fall due on the same wake-up and
+  // share one snapshot.
+  auto interval = std::chrono::milliseconds(updateIntervalMs_.load());
+  auto origin = Clock::now();
+  auto lastPublish = origin;
+  auto nextPublish = origin + interval;
+  auto deadline = std::min(nextPublish, nextSubscriberDue(origin));
+  auto nextMemoryBreakdown = origin; // sampled after the first delivery
+
+  // CPU, scheduler and fault intervals start now; time spent stopped
+  // isn't one
+  platform_->markCurrentThread(::nitroperf::ThreadRole::kMonitor);
+  platform_->sampleCpuUsage(cpuUsageScratch_);
+  {
+    std::lock_guard<std::mutex> counterLock(counterMutex_);
+    schedRateBaseNs_.fill(0);
+    faultRateBaseNs_ = 0;
+    sampleCountersLocked(true);
+  }
+
+  // Onsets signalled while stopped are stale
+  for (size_t thread = 0; thread < jankSignals_.size(); thread++) {
+    jankDelivered_[thread] = jankSignals_[thread].load().sequence;
+  }
+
+  std::unique_lock<std::mutex> lock(timerMutex_);
   while (timerRunning_.load()) {
-    int intervalMs = updateIntervalMs_.load();
-    std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    timerCv_.wait_until(lock, deadline, [this, &deadline] {
+      return !timerRunning_.load() || timerRescheduled_ || jankPending_ || Clock::now() >= deadline;
+    });
+    if (!timerRunning_.load()) break;
+
+    if (jankPending_) {
+      // Out of band: deliver right away, then go back to the same deadline
+      jankPending_ = false;
+      lock.unlock();
+      deliverJank();
+      lock.lock();
+      continue;
+    }
+
+    if (timerRescheduled_) {
+      // A new global interval counts from the last publish, so shortening
+      // it fires right away if that tick is already overdue. New
+      // subscribers are picked up by re-scanning the due times.
+      timerRescheduled_ = false;
+      auto newInterval = std::chrono::milliseconds(updateIntervalMs_.load());
+      if (newInterval != interval) {
+        interval = newInterval;
+        origin = lastPublish;
+        nextPublish = lastPublish + interval;
+      }
+      deadline = std::min(nextPublish, nextSubscriberDue(Clock::now()));
+      continue;
+    }
+
+    auto now = Clock::now();
+    schedulerLatenessMs_.store(
+        std::chrono::duration<double, std::milli>(now - deadline).count(),
+        std::memory_order_relaxed);
+
+    // Faster subscribers wake the timer in between; only the global
+    // cadence feeds retained history, so its resolution doesn't depend on
+    // who is subscribed.
+    bool publishDue = nextPublish <= now + kCoalesceWindow;
+
+    lock.unlock();
+    PerfSnapshot snapshot;
+    {
+      // One critical section with the append: reset() clears the stores
+      // under this lock, and a snapshot composed before it mustn't land
+      // in them afterwards
+      std::lock_guard<std::mutex> publishLock(publishMutex_);
+      snapshot = publishSnapshotLocked();
+      if (publishDue) {
+        recordHistory(snapshot);
+      }
+    }
+    deliverDue(snapshot, now, origin, interval);
+    if (publishDue) {
+      std::lock_guard<std::mutex> counterLock(counterMutex_);
+      sampleCountersLocked(true);
+    }
+    deliverStutters();
+
+    // The breakdown has its own, slower cadence and is sampled after
+    // delivery, so its cost never delays a snapshot; the next one
+    // carries it.
+    auto memoryInterval = std::chrono::milliseconds(memoryBreakdownIntervalMs_.load());
+    if (memoryInterval.count() == 0) {
+      memoryBreakdown_.store(::nitroperf::MemoryBreakdown{});
+      nextMemoryBreakdown = now;
+    } else if (now >= nextMemoryBreakdown) {
+      memoryBreakdown_.store(platform_->getMemoryBreakdown());
+      nextMemoryBreakdown = now + memoryInterval;
+    }
+    if (publishDue) {
+      sampleCpuUsage();
+    }
+    lock.lock();
+
+    // Advance on the absolute grid so delivery cost never accumulates as
+    // drift; overrun intervals are skipped rather than fired as a burst.
+    if (publishDue) {
+      nextPublish = nextGridPoint(origin, interval, now + kCoalesceWindow);
+      lastPublish = nextPublish - interval;
+    }
+    deadline = std::min(nextPublish, nextSubscriberDue(Clock::now()));
+  }
+}
+
+void HybridPerfMonitor::deliverDue(const PerfSnapshot& snapshot,
+                                   std::chrono::steady_clock::time_point now,
+                                   std::chrono::steady_clock::time_point origin,
+                                   std::chrono::milliseconds globalInterval) {
+  std::vector<double> values;
+  subscribers_.forEach([&](const Subscriber& subscriber) {
+    auto& nextDue = subscriber.delivery->nextDue;
+    if (nextDue > now + kCoalesceWindow) return;
+
+    auto interval = subscriber.interval.count() > 0 ? subscriber.interval : globalInterval;
+    nextDue = nextGridPoint(origin, interval, now + kCoalesceWindow);
 
-    if (timerRunning_.load()) {
-      notifySubscribers();
+    if (subscriber.callback) {
+      subscriber.callback(snapshot);
+      return;
     }
+    if (subscriber.changesCallback) {
+      deliverChanges(subscriber, snapshot, now, values);
+      return;
+    }
+    values.clear();
+    for (size_t i = 0; i < std::size(kSnapshotFields); i++) {
+      if (subscriber.fieldMask & (uint64_t{1} << i)) {
+        values.push_back(snapshot.*kSnapshotFields[i]);
+      }
+    }
+    subscriber.valuesCallback(values);
+  });
+}
+
+void HybridPerfMonitor::deliverChanges(const Subscriber& subscriber, const PerfSnapshot& snapshot,
+                                       std::chrono::steady_clock::time_point now,
+                                       std::vector<double>& values) {
+  DeliveryState& state = *subscriber.delivery;
+
+  uint64_t changed = 0;
+  for (size_t i = 0; i < std::size(kSnapshotFields); i++) {
+    uint64_t bit = uint64_t{1} << i;
+    if (!(subscriber.fieldMask & bit)) continue;
+    // Compared against the last *delivered* value, so slow drift still
+    // crosses the threshold eventually.
+    double last = state.lastValues[i];
+    if (std::isnan(last) || std::abs(snapshot.*kSnapshotFields[i] - last) > subscriber.epsilons[i]) {
+      changed |= bit;
+    }
+  }
+
+  if (changed == 0) {
+    // Idle tick: stay silent unless the heartbeat is due
+    if (subscriber.heartbeat.count() == 0 || now - state.lastDelivery < subscriber.heartbeat) return;
+  }
+  // The timestamp never counts as a change but dates every delivery
+  changed |= subscriber.fieldMask & kTimestampBit;
+
+  values.clear();
+  for (size_t i = 0; i < std::size(kSnapshotFields); i++) {
+    if (changed & (uint64_t{1} << i)) {
+      double value = snapshot.*kSnapshotFields[i];
+      state.lastValues[i] = value;
+      values.push_back(value);
+    }
+  }
+  state.lastDelivery = now;
+  subscriber.changesCallback(static_cast<double>(changed), values);
+}
+
+std::chrono::steady_clock::time_point HybridPerfMonitor::nextSubscriberDue(
+    std::chrono::steady_clock::time_point now) {
+  auto earliest = std::chrono::steady_clock::time_point::max();
+  subscribers_.forEach([&](const Subscriber& subscriber) {
+    earliest = std::min(earliest, std::max(subscriber.delivery->nextDue, now));
+  });
+  return earliest;
+}
+
+void HybridPerfMonitor::deliverStutters() {
+  // The cursors advance with or without subscribers, so a new subscriber
+  // starts with the next episode rather than a backlog
+  auto ui = uiFpsTracker_->getEpisodesSince(uiEpisodeCursor_);
+  auto js = jsFpsTracker_->getEpisodesSince(jsEpisodeCursor_);
+  uiEpisodeCursor_ = ui.cursor;
+  jsEpisodeCursor_ = js.cursor;
+  if (ui.episodes.empty() && js.episodes.empty()) return;
+
+  std::vector<StutterEpisode> episodes = toStutterEpisodes(ui, js);
+  subscribers_.forEach([&](const Subscriber& subscriber) {
+    if (subscriber.stuttersCallback) subscriber.stuttersCallback(episodes);
+  });
+}
+
+void HybridPerfMonitor::onJankOnset(size_t thread, const ::nitroperf::FPSTracker::JankOnset& onset) {
+  if (jankSubscriberCount_.load(std::memory_order_relaxed) == 0) return;
+
+  jankSignals_[thread].store(JankSignal{onset, ++jankSignalCounts_[thread]});
+  {
+    // Setting the flag under the timer mutex means the timer either sees
+    // it before it waits or is already waiting and gets the notify. This
+    // is the only lock a producer takes, and only at a jank onset.
+    std::lock_guard<std::mutex> lock(timerMutex_);
+    jankPending_ = true;
+  }
+  timerCv_.notify_all();
+}
+
+void HybridPerfMonitor::deliverJank() {
+  constexpr double kNsToMs = 1.0 / 1e6;
+  for (size_t thread = 0; thread < jankSignals_.size(); thread++) {
+    JankSignal signal = jankSignals_[thread].load();
+    if (signal.sequence == jankDelivered_[thread]) continue;
+    // Onsets overwritten before the timer got to them
+    double coalesced = static_cast<double>(signal.sequence - jankDelivered_[thread] - 1);
+    jankDelivered_[thread] = signal.sequence;
+
+    const auto& onset = signal.onset;
+    JankEvent event(
+      kThreadNames[thread],
+      timebase_.toWallMs(onset.frameEndNs),
+      static_cast<double>(onset.frameNs) * kNsToMs,
+      static_cast<double>(onset.framesSkipped),
+      onset.episodeStart,
+      onset.overThreshold,
+      // From the end of the slow frame to handing the event to subscribers
+      static_cast<double>(::nitroperf::Timebase::nowNs() - onset.frameEndNs) * kNsToMs,
+      coalesced
+    );
+    subscribers_.forEach([&](const Subscriber& subscriber) {
+      if (subscriber.jankCallback) subscriber.jankCallback(event);
+    });
   }
 }
 
 double HybridPerfMonitor::getCurrentTimestamp() const {
-  auto now = std::chrono::system_clock::now();
-  auto duration = now.time_since_epoch();
-  auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-  return static_cast<double>(millis.count());
+  // Wall time derived from the monotonic clock: never jumps with NTP
+  return timebase_.nowWallMs();
 }
 
 } // namespace margelo::nitro::nitroperf
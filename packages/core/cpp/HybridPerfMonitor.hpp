@@ -1,15 +1,27 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <chrono>
+#include <optional>
+#include <vector>
 #include <functional>
-#include <unordered_map>
 #include <thread>
+#include <condition_variable>
 
 #include "HybridPerfMonitorSpec.hpp"
 #include "FPSTracker.hpp"
+#include "LatencyHistogram.hpp"
 #include "PlatformMetrics.hpp"
+#include "SeqLock.hpp"
+#include "ComponentRenderTracker.hpp"
+#include "CopyOnWriteList.hpp"
+#include "MetricRollup.hpp"
+#include "CounterTimeline.hpp"
+#include "TimeSeriesStore.hpp"
+#include "Timebase.hpp"
 
 namespace margelo::nitro::nitroperf {
 
@@ -29,37 +41,225 @@ public:
   void stop() override;
   PerfSnapshot getMetrics() override;
   FPSHistory getHistory() override;
-  double subscribe(const std::function<void(const PerfSnapshot&)>& cb) override;
+  double getHistoryGeneration() override;
+  FPSHistoryBuffer getHistoryBuffer() override;
+  FPSHistoryDelta getHistorySince(const HistoryCursor& cursor) override;
+  MetricRollups getRollups(double fromMs, double toMs, double maxPoints) override;
+  SnapshotSeries getSnapshotRange(double fromMs, double toMs, double fieldMask, double maxRows) override;
+  FrameTimePercentiles getFrameTimePercentiles() override;
+  Distributions getDistributions() override;
+  ThreadCpuUsage getThreadCpuUsage() override;
+  void setRawFrameCapture(double capacity) override;
+  RawFrameTimestamps getRawFramesSince(const HistoryCursor& cursor) override;
+  StutterEpisodes getStutterEpisodesSince(const HistoryCursor& cursor) override;
+  double subscribe(const std::function<void(const PerfSnapshot&)>& cb,
+                   const std::optional<double>& intervalMs) override;
+  double subscribeFields(double fieldMask, double intervalMs,
+                         const std::function<void(const std::vector<double>&)>& cb) override;
+  double subscribeChanges(double fieldMask, double intervalMs, double heartbeatMs,
+                          const std::vector<double>& epsilons,
+                          const std::function<void(double, const std::vector<double>&)>& cb) override;
+  double subscribeStutters(const std::function<void(const std::vector<StutterEpisode>&)>& cb) override;
+  double subscribeJank(const std::function<void(const JankEvent&)>& cb) override;
   void unsubscribe(double id) override;
   void reportJsFrameTick(double ts) override;
+  void reportJsFrameTicks(const std::shared_ptr<ArrayBuffer>& timestamps, double count) override;
+  void calibrateJsClock(double performanceNowMs) override;
+  ClockMapping getClockMapping() override;
   void reportLongTask(double durationMs) override;
   void reportSlowEvent(double durationMs) override;
   void reportRender(double actualDurationMs) override;
+  double registerComponent(const std::string& name) override;
+  void reportComponentRender(double componentId, double phase, double actualDurationMs) override;
+  std::vector<ComponentRenderStats> getComponentRenderStats(double maxCount) override;
+  void resetComponentRenderStats() override;
   void reportJsHeap(double usedBytes, double totalBytes) override;
   void configure(const PerfConfig& config) override;
   void reset() override;
 
 private:
-  void notifySubscribers();
+  /**
+   * Compose a snapshot from the trackers and counters and publish it.
+   * Returns the published snapshot.
+   */
+  PerfSnapshot publishSnapshot();
+  PerfSnapshot publishSnapshotLocked();
+  struct Subscriber;
+  double addSubscriber(Subscriber subscriber);
+  void wakeTimer();
   void timerLoop();
+  /**
+   * Append a global-cadence snapshot to the snapshot store and rollups,
+   * and close the current distribution interval. Call with publishMutex_
+   * held, in the same critical section that composed the snapshot.
+   */
+  void recordHistory(const PerfSnapshot& snapshot);
+  /** Long task, slow event and render histograms, in that order. */
+  std::array<::nitroperf::LatencyHistogram::Snapshot, 3> captureDistributions() const;
+  void rollDistributionInterval();
+  /** Deliver `snapshot` to every subscriber due by `now` and schedule its next delivery. */
+  void deliverDue(const PerfSnapshot& snapshot,
+                  std::chrono::steady_clock::time_point now,
+                  std::chrono::steady_clock::time_point origin,
+                  std::chrono::milliseconds globalInterval);
+  void deliverChanges(const Subscriber& subscriber, const PerfSnapshot& snapshot,
+                      std::chrono::steady_clock::time_point now, std::vector<double>& values);
+  std::chrono::steady_clock::time_point nextSubscriberDue(std::chrono::steady_clock::time_point now);
+  /** Deliver episodes closed since the last call to stutter subscribers. */
+  void deliverStutters();
+  /** Tracker jank listener; runs on that tracker's producer thread. */
+  void onJankOnset(size_t thread, const ::nitroperf::FPSTracker::JankOnset& onset);
+  /** Deliver jank onsets signalled since the last call to jank subscribers. */
+  void deliverJank();
+  /** Sample per-thread CPU over the interval since the last call and publish it. */
+  void sampleCpuUsage();
+  /** Both trackers' episodes on the wall clock, ordered by start. */
+  std::vector<StutterEpisode> toStutterEpisodes(const ::nitroperf::FPSTracker::EpisodesSince& ui,
+                                                const ::nitroperf::FPSTracker::EpisodesSince& js);
+  /**
+   * Sample the UI and JS threads' scheduler counters and the process's
+   * page faults into their timelines; `updateRates` also refreshes the
+   * per-second snapshot rates.
+   */
+  void sampleCountersLocked(bool updateRates);
   double getCurrentTimestamp() const;
 
-  std::unique_ptr<::nitroperf::FPSTracker> uiFpsTracker_;
-  std::unique_ptr<::nitroperf::FPSTracker> jsFpsTracker_;
+  /** Int32 sample buffer for one tracker, rebuilt only when its generation moves. */
+  struct HistoryBufferCache {
+    uint64_t generation = UINT64_MAX;
+    std::shared_ptr<ArrayBuffer> buffer;
+  };
+  static std::shared_ptr<ArrayBuffer> cachedHistoryBuffer(const ::nitroperf::FPSTracker& tracker,
+                                                          HistoryBufferCache& cache);
+
+  // Trackers live as long as the monitor: the platform frame callback
+  // captures them, so configure() resizes them in place instead of
+  // replacing them.
+  const std::unique_ptr<::nitroperf::FPSTracker> uiFpsTracker_;
+  const std::unique_ptr<::nitroperf::FPSTracker> jsFpsTracker_;
   std::unique_ptr<::nitroperf::PlatformMetrics> platform_;
 
   std::atomic<bool> isRunning_{false};
   std::atomic<int> updateIntervalMs_{500};
-  int targetFps_ = 60;
 
-  // Subscriber management
-  mutable std::mutex subscriberMutex_;
-  std::unordered_map<double, std::function<void(const PerfSnapshot&)>> subscribers_;
+  // Every timestamp (frames, snapshots, scheduling) is on this clock;
+  // JS performance.now() and wall time are mapped onto it.
+  ::nitroperf::Timebase timebase_;
+
+  // Latest coherent snapshot. Written by the timer thread and by
+  // start/stop/reset (serialized by publishMutex_); getMetrics() reads it
+  // lock-free with a single copy.
+  ::nitroperf::SeqLocked<PerfSnapshot> snapshot_;
+  std::mutex publishMutex_;
+
+  // Retained history, fed by the timer thread at the global interval.
+  // Every snapshot field as one column, oldest rows overwritten.
+  ::nitroperf::TimeSeriesStore snapshotStore_;
+  // Session-long min/max/mean at 1 s .. 10 min resolution. Fixed size.
+  ::nitroperf::MetricRollup rollups_;
+  double lastRollupDroppedFrames_ = 0.0; // guarded by publishMutex_
+
+  // Immutable history buffers handed to JS; callers sharing a generation
+  // share the same native memory.
+  std::mutex historyBufferMutex_;
+  HistoryBufferCache uiHistoryBuffer_;
+  HistoryBufferCache jsHistoryBuffer_;
+
+  // Subscriber management. Dispatch iterates an immutable snapshot of the
+  // list without locking; subscribe/unsubscribe publish a new copy.
+  // Each subscriber has its own cadence (0 = follow updateIntervalMs_);
+  // field subscribers receive only the masked fields as a flat array, and
+  // change subscribers only the fields that moved beyond their epsilon.
+  // Stutter subscribers have no cadence; they hear about every episode
+  // on the first timer wake after it closes. Jank subscribers wake the
+  // timer themselves, out of band.
+  struct DeliveryState {
+    std::chrono::steady_clock::time_point nextDue{}; // epoch = due now
+    std::chrono::steady_clock::time_point lastDelivery{};
+    std::vector<double> lastValues; // last delivered value per field (NaN = never)
+  };
+  struct Subscriber {
+    double id = 0;
+    std::chrono::milliseconds interval{0};
+    uint64_t fieldMask = 0;
+    std::function<void(const PerfSnapshot&)> callback;
+    std::function<void(const std::vector<double>&)> valuesCallback;
+    std::function<void(double, const std::vector<double>&)> changesCallback;
+    std::function<void(const std::vector<StutterEpisode>&)> stuttersCallback;
+    std::function<void(const JankEvent&)> jankCallback;
+    std::chrono::milliseconds heartbeat{0}; // 0 = never deliver an unchanged tick
+    std::vector<double> epsilons;
+    // Shared by every copy of the list; only the timer thread touches it
+    std::shared_ptr<DeliveryState> delivery;
+  };
+  ::nitroperf::CopyOnWriteList<Subscriber> subscribers_;
   std::atomic<int> nextSubscriberId_{1};
 
-  // Notification timer thread
+  // Notification timer thread. Wakes on absolute steady_clock deadlines —
+  // the earlier of the next global publish and the next subscriber due;
+  // stop()/configure()/subscribe() interrupt the wait through timerCv_.
   std::thread timerThread_;
   std::atomic<bool> timerRunning_{false};
+  std::mutex timerMutex_;
+  std::condition_variable timerCv_;
+  bool timerRescheduled_ = false; // guarded by timerMutex_
+  bool jankPending_ = false;      // guarded by timerMutex_
+  std::atomic<double> schedulerLatenessMs_{0.0};
+  std::atomic<int> memoryBreakdownIntervalMs_{5000}; // 0 = don't sample
+  uint64_t uiEpisodeCursor_ = 0; // timer thread only
+  uint64_t jsEpisodeCursor_ = 0; // timer thread only
+
+  // Latest jank onset per thread (UI, JS). Each slot is written only by
+  // its tracker's producer; the timer thread delivers it.
+  struct JankSignal {
+    ::nitroperf::FPSTracker::JankOnset onset;
+    uint64_t sequence; // 0 = never signalled (SeqLocked value-initializes)
+  };
+  std::array<::nitroperf::SeqLocked<JankSignal>, 2> jankSignals_;
+  std::array<uint64_t, 2> jankSignalCounts_{}; // element i: producer i only
+  std::array<uint64_t, 2> jankDelivered_{};    // timer thread only
+  std::atomic<int> jankSubscriberCount_{0};
+
+  // Latest memory breakdown, sampled by the timer thread every
+  // memoryBreakdownIntervalMs_ and copied into each snapshot
+  ::nitroperf::SeqLocked<::nitroperf::MemoryBreakdown> memoryBreakdown_;
+
+  // CPU use over the last global interval, sampled by the timer thread.
+  // The per-role summary feeds snapshots; getThreadCpuUsage() copies the
+  // full per-thread sample.
+  struct CpuSummary {
+    double process;
+    double ui;
+    double js;
+  };
+  ::nitroperf::SeqLocked<CpuSummary> cpuSummary_;
+  std::mutex cpuUsageMutex_;
+  ::nitroperf::CpuUsage cpuUsage_;        // guarded by cpuUsageMutex_
+  ::nitroperf::CpuUsage cpuUsageScratch_; // timer thread only
+
+  // Scheduler counters of the UI and JS threads (indexed like the
+  // trackers) and the process's page faults. Sampled each global interval
+  // for the per-second rates in snapshots, and again when an episode ends
+  // after the newest sample, so every episode is credited its thread's
+  // on-CPU and run-queue time and the faults taken during it.
+  struct CounterRates {
+    std::array<double, 2> runQueueMsPerSec;
+    std::array<double, 2> preemptionsPerSec;
+    std::array<double, 2> voluntarySwitchesPerSec;
+    double minorFaultsPerSec;
+    double majorFaultsPerSec;
+  };
+  ::nitroperf::SeqLocked<CounterRates> counterRates_;
+  std::mutex counterMutex_;
+  // Guarded by counterMutex_. Timelines hold {run, run queue} ns and
+  // {minor, major} faults.
+  std::array<::nitroperf::CounterTimeline, 2> schedTimelines_;
+  ::nitroperf::CounterTimeline faultTimeline_;
+  std::array<::nitroperf::ThreadSchedStats, 2> schedRateBase_{};
+  std::array<int64_t, 2> schedRateBaseNs_{};
+  ::nitroperf::PageFaults faultRateBase_{};
+  int64_t faultRateBaseNs_ = 0;
+  int64_t countersSampledNs_ = 0;
 
   // JS heap values (set from JS side or Hermes instrumentation)
   std::atomic<int64_t> jsHeapUsed_{0};
@@ -67,11 +267,30 @@ private:
 
   // New architecture metrics (set from JS side via report*() methods)
   std::atomic<int64_t> longTaskCount_{0};
-  std::atomic<int64_t> longTaskTotalMs_{0};
   std::atomic<int64_t> slowEventCount_{0};
   std::atomic<double> maxEventDurationMs_{0.0};
   std::atomic<int64_t> renderCount_{0};
   std::atomic<double> lastRenderDurationMs_{0.0};
+
+  // Durations behind the counters above (µs). record() never blocks, so
+  // PerfProfiler can report every React commit.
+  ::nitroperf::LatencyHistogram longTaskDurations_;
+  ::nitroperf::LatencyHistogram slowEventDurations_;
+  ::nitroperf::LatencyHistogram renderDurations_;
+
+  // Hottest React components (Space-Saving top-K) and interned names
+  ::nitroperf::ComponentRenderTracker componentRenders_;
+
+  // Distributions of the last complete global update interval: the
+  // difference between the histograms at consecutive publishes.
+  struct DistributionIntervals {
+    std::array<::nitroperf::LatencyHistogram::Snapshot, 3> baseline{};
+    std::array<::nitroperf::LatencyHistogram::Snapshot, 3> interval{};
+    std::chrono::steady_clock::time_point rolledAt{};
+    double intervalMs = 0.0;
+  };
+  std::mutex distributionMutex_;
+  DistributionIntervals distributionIntervals_; // guarded by distributionMutex_
 };
 
 } // namespace margelo::nitro::nitroperf
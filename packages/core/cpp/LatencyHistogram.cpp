@@ -0,0 +1,133 @@
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace nitroperf {
+
+namespace {
+constexpr auto kRelaxed = std::memory_order_relaxed;
+} // namespace
+
+size_t LatencyHistogram::bucketIndex(uint64_t valueUs) noexcept {
+  if (valueUs < kSubBucketCount) {
+    return static_cast<size_t>(valueUs);
+  }
+
+  size_t msb = static_cast<size_t>(std::bit_width(valueUs)) - 1;
+  if (msb >= kMaxValueBits) {
+    return kBucketCount - 1;
+  }
+
+  size_t magnitude = msb - kSubBucketBits;
+  size_t subBucket = static_cast<size_t>(valueUs >> magnitude) - kSubBucketCount;
+  return kSubBucketCount + magnitude * kSubBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(size_t index) noexcept {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  size_t magnitude = (index - kSubBucketCount) / kSubBucketCount;
+  size_t subBucket = (index - kSubBucketCount) % kSubBucketCount;
+  return static_cast<uint64_t>(kSubBucketCount + subBucket) << magnitude;
+}
+
+uint64_t LatencyHistogram::bucketWidth(size_t index) noexcept {
+  if (index < kSubBucketCount) {
+    return 1;
+  }
+  return uint64_t{1} << ((index - kSubBucketCount) / kSubBucketCount);
+}
+
+void LatencyHistogram::record(uint64_t valueUs) noexcept {
+  counts_[bucketIndex(valueUs)].fetch_add(1, kRelaxed);
+  sumUs_.fetch_add(valueUs, kRelaxed);
+
+  uint64_t currentMax = maxUs_.load(kRelaxed);
+  while (valueUs > currentMax) {
+    if (maxUs_.compare_exchange_weak(currentMax, valueUs, kRelaxed)) {
+      break;
+    }
+  }
+}
+
+void LatencyHistogram::clear() noexcept {
+  for (auto& bucket : counts_) {
+    bucket.store(0, kRelaxed);
+  }
+  sumUs_.store(0, kRelaxed);
+  maxUs_.store(0, kRelaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const noexcept {
+  Snapshot result;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    uint64_t n = counts_[i].load(kRelaxed);
+    result.counts[i] = n;
+    result.count += n;
+  }
+  result.sumUs = sumUs_.load(kRelaxed);
+  result.maxUs = maxUs_.load(kRelaxed);
+  return result;
+}
+
+double LatencyHistogram::Snapshot::percentile(double q) const {
+  if (count == 0) return 0.0;
+
+  q = std::clamp(q, 0.0, 1.0);
+  uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    cumulative += counts[i];
+    if (cumulative >= rank) {
+      // Report the bucket midpoint, but never more than the observed max
+      double midpoint = static_cast<double>(bucketLowerBound(i)) +
+                        static_cast<double>(bucketWidth(i) - 1) / 2.0;
+      return std::min(midpoint, static_cast<double>(maxUs));
+    }
+  }
+  return static_cast<double>(maxUs);
+}
+
+double LatencyHistogram::Snapshot::mean() const {
+  return count > 0 ? static_cast<double>(sumUs) / static_cast<double>(count) : 0.0;
+}
+
+uint64_t LatencyHistogram::Snapshot::countAtLeast(uint64_t valueUs) const {
+  uint64_t total = 0;
+  for (size_t i = bucketIndex(valueUs); i < kBucketCount; i++) {
+    total += counts[i];
+  }
+  return total;
+}
+
+void LatencyHistogram::Snapshot::merge(const Snapshot& other) {
+  for (size_t i = 0; i < kBucketCount; i++) {
+    counts[i] += other.counts[i];
+  }
+  count += other.count;
+  sumUs += other.sumUs;
+  maxUs = std::max(maxUs, other.maxUs);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::Snapshot::since(const Snapshot& earlier) const {
+  Snapshot result;
+  size_t highest = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    // Buckets are read one at a time, so a racing record() can make a
+    // later snapshot's bucket briefly lag; never go negative
+    uint64_t n = counts[i] > earlier.counts[i] ? counts[i] - earlier.counts[i] : 0;
+    result.counts[i] = n;
+    result.count += n;
+    if (n > 0) highest = i;
+  }
+  result.sumUs = sumUs > earlier.sumUs ? sumUs - earlier.sumUs : 0;
+  if (result.count > 0) {
+    result.maxUs = std::min(maxUs, bucketLowerBound(highest) + bucketWidth(highest) - 1);
+  }
+  return result;
+}
+
+} // namespace nitroperf
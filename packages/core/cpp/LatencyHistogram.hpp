@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nitroperf {
+
+/**
+ * Fixed-memory log-linear (HDR-style) histogram of durations in microseconds.
+ *
+ * Values below 32 µs get exact buckets; above that every power-of-two range
+ * is split into 32 linear sub-buckets, bounding the relative error to ~3%.
+ * Values above ~16.7 s land in the last bucket. record() is O(1), never
+ * allocates, and only uses relaxed atomic increments (plus a CAS for the
+ * max that only retries when another thread raised it concurrently).
+ *
+ * Snapshots are plain bucket counts, so they merge by addition and an
+ * interval is the difference of two snapshots of the same histogram.
+ */
+class LatencyHistogram {
+public:
+  static constexpr size_t kSubBucketBits = 5;
+  static constexpr size_t kSubBucketCount = size_t{1} << kSubBucketBits;
+  static constexpr size_t kMaxValueBits = 24;
+  static constexpr size_t kBucketCount =
+      kSubBucketCount + (kMaxValueBits - kSubBucketBits) * kSubBucketCount;
+
+  /** Point-in-time copy of the histogram, safe to query off-thread. */
+  struct Snapshot {
+    std::array<uint64_t, kBucketCount> counts{};
+    uint64_t count = 0;
+    uint64_t sumUs = 0;
+    uint64_t maxUs = 0;
+
+    /** Value at quantile q in [0, 1], in microseconds. 0 when empty. */
+    double percentile(double q) const;
+
+    /** Mean recorded value in microseconds. 0 when empty. */
+    double mean() const;
+
+    /** Values recorded at or above `valueUs`, to bucket resolution. */
+    uint64_t countAtLeast(uint64_t valueUs) const;
+
+    /** Add another snapshot's values (e.g. another histogram or session). */
+    void merge(const Snapshot& other);
+
+    /**
+     * Values recorded after `earlier`, a previous snapshot of the same
+     * histogram with no clear() in between. The max is bounded by the
+     * highest bucket that grew.
+     */
+    Snapshot since(const Snapshot& earlier) const;
+  };
+
+  LatencyHistogram() = default;
+
+  /** Record one duration in microseconds. */
+  void record(uint64_t valueUs) noexcept;
+
+  /** Zero all buckets. */
+  void clear() noexcept;
+
+  /** Copy the current bucket counts. */
+  Snapshot snapshot() const noexcept;
+
+  /** Sum of all recorded values, without copying the buckets. */
+  uint64_t sumUs() const noexcept { return sumUs_.load(std::memory_order_relaxed); }
+
+  static size_t bucketIndex(uint64_t valueUs) noexcept;
+  static uint64_t bucketLowerBound(size_t index) noexcept;
+  static uint64_t bucketWidth(size_t index) noexcept;
+
+private:
+  std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+  std::atomic<uint64_t> sumUs_{0};
+  std::atomic<uint64_t> maxUs_{0};
+};
+
+} // namespace nitroperf
@@ -0,0 +1,150 @@
+#include "MetricRollup.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace nitroperf {
+
+namespace {
+int64_t floorTo(int64_t value, int64_t step) {
+  int64_t q = value / step;
+  if (value % step != 0 && value < 0) q--;
+  return q * step;
+}
+} // namespace
+
+MetricRollup::MetricRollup() : buckets_(kTotalBuckets) {
+  size_t offset = 0;
+  for (size_t t = 0; t < kTiers.size(); t++) {
+    tiers_[t].offset = offset;
+    offset += kTiers[t].capacity;
+  }
+  clearLocked();
+}
+
+void MetricRollup::startBucket(Bucket& bucket, int64_t startMs) {
+  bucket.startMs = startMs;
+  bucket.count = 0;
+  for (auto& stat : bucket.stats) {
+    stat.min = std::numeric_limits<float>::max();
+    stat.max = std::numeric_limits<float>::lowest();
+    stat.sum = 0.0;
+  }
+}
+
+void MetricRollup::record(int64_t timestampMs, const Values& values) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (size_t t = 0; t < kTiers.size(); t++) {
+    const TierSpec& spec = kTiers[t];
+    Tier& tier = tiers_[t];
+    int64_t startMs = floorTo(timestampMs, spec.resolutionMs);
+
+    if (tier.empty) {
+      tier.empty = false;
+      startBucket(buckets_[tier.offset + tier.head], startMs);
+    } else if (startMs > buckets_[tier.offset + tier.head].startMs) {
+      // New bucket; idle gaps simply have no bucket. A wall-clock step
+      // backwards keeps folding into the current one.
+      tier.head = (tier.head + 1) % spec.capacity;
+      Bucket& slot = buckets_[tier.offset + tier.head];
+      if (slot.count > 0) {
+        tier.evictedStartMs = slot.startMs;
+      }
+      startBucket(slot, startMs);
+    }
+
+    Bucket& bucket = buckets_[tier.offset + tier.head];
+    bucket.count++;
+    for (size_t m = 0; m < kMetricCount; m++) {
+      float value = static_cast<float>(values[m]);
+      Stat& stat = bucket.stats[m];
+      stat.min = std::min(stat.min, value);
+      stat.max = std::max(stat.max, value);
+      stat.sum += values[m];
+    }
+  }
+}
+
+MetricRollup::Series MetricRollup::query(int64_t fromMs, int64_t toMs, size_t maxPoints) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Series series;
+  maxPoints = std::max<size_t>(maxPoints, 1);
+  if (toMs <= 0) toMs = std::numeric_limits<int64_t>::max();
+
+  // Pick the finest tier that hasn't evicted anything inside the range
+  // and fits the point budget
+  size_t chosen = kTiers.size() - 1;
+  for (size_t t = 0; t < kTiers.size(); t++) {
+    const Tier& tier = tiers_[t];
+    if (tier.empty) {
+      chosen = t;
+      break;
+    }
+    bool wrapped = tier.evictedStartMs != INT64_MIN;
+    int64_t oldestMs = buckets_[tier.offset + (wrapped ? (tier.head + 1) % kTiers[t].capacity : 0)].startMs;
+    int64_t newestMs = buckets_[tier.offset + tier.head].startMs;
+    int64_t spanFrom = std::max(fromMs, oldestMs);
+    int64_t spanTo = std::min(toMs, newestMs);
+    bool covers = tier.evictedStartMs < fromMs;
+    size_t points = spanTo >= spanFrom
+        ? static_cast<size_t>((spanTo - spanFrom) / kTiers[t].resolutionMs) + 1
+        : 0;
+    if (covers && points <= maxPoints) {
+      chosen = t;
+      break;
+    }
+  }
+
+  const TierSpec& spec = kTiers[chosen];
+  const Tier& tier = tiers_[chosen];
+  series.resolutionMs = spec.resolutionMs;
+  if (tier.empty) return series;
+
+  // Walk newest to oldest, then reverse into chronological order
+  std::vector<const Bucket*> selected;
+  for (size_t i = 0; i < spec.capacity && selected.size() < maxPoints; i++) {
+    const Bucket& bucket = buckets_[tier.offset + (tier.head + spec.capacity - i) % spec.capacity];
+    if (bucket.count == 0) break;
+    if (bucket.startMs + spec.resolutionMs <= fromMs) break;
+    if (bucket.startMs > toMs) continue;
+    selected.push_back(&bucket);
+  }
+  std::reverse(selected.begin(), selected.end());
+
+  series.startMs.reserve(selected.size());
+  series.counts.reserve(selected.size());
+  for (size_t m = 0; m < kMetricCount; m++) {
+    series.min[m].reserve(selected.size());
+    series.max[m].reserve(selected.size());
+    series.mean[m].reserve(selected.size());
+  }
+  for (const Bucket* bucket : selected) {
+    series.startMs.push_back(bucket->startMs);
+    series.counts.push_back(bucket->count);
+    for (size_t m = 0; m < kMetricCount; m++) {
+      const Stat& stat = bucket->stats[m];
+      series.min[m].push_back(stat.min);
+      series.max[m].push_back(stat.max);
+      series.mean[m].push_back(stat.sum / bucket->count);
+    }
+  }
+  return series;
+}
+
+void MetricRollup::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  clearLocked();
+}
+
+void MetricRollup::clearLocked() {
+  for (auto& bucket : buckets_) {
+    bucket.count = 0;
+  }
+  for (auto& tier : tiers_) {
+    tier.head = 0;
+    tier.empty = true;
+    tier.evictedStartMs = INT64_MIN;
+  }
+}
+
+} // namespace nitroperf
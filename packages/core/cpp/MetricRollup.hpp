@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace nitroperf {
+
+/**
+ * Fixed-memory multi-resolution rollups of session metrics.
+ *
+ * Every record() is folded into four tiers of time-aligned buckets
+ * (1 s, 10 s, 60 s, 10 min), each a ring that keeps min/max/sum per metric
+ * and a sample count. Storage is allocated once in the constructor
+ * (~100 KB, see kMemoryBytes) and never grows, so an hour-long soak test
+ * costs the same as a one-minute one; older data survives at coarser
+ * resolution after the finer tiers have wrapped.
+ *
+ * Threading: record(), query() and clear() may be called from any thread
+ * and are serialized by an internal mutex. record() is O(tiers).
+ */
+class MetricRollup {
+public:
+  enum Metric : size_t {
+    kUiFps,
+    kJsFps,
+    kRamBytes,
+    kJsHeapUsedBytes,
+    kDroppedFrames,
+    kMetricCount,
+  };
+
+  using Values = std::array<double, kMetricCount>;
+
+  struct TierSpec {
+    int64_t resolutionMs;
+    size_t capacity;
+  };
+
+  // 5 min at 1 s, 1 h at 10 s, 4 h at 60 s, 24 h at 10 min
+  static constexpr std::array<TierSpec, 4> kTiers = {{
+    {1000, 300},
+    {10000, 360},
+    {60000, 240},
+    {600000, 144},
+  }};
+
+  /** Buckets of one tier within a time range, oldest first, column-wise. */
+  struct Series {
+    int64_t resolutionMs = 0;
+    std::vector<int64_t> startMs;
+    std::vector<uint32_t> counts;
+    std::array<std::vector<double>, kMetricCount> min;
+    std::array<std::vector<double>, kMetricCount> max;
+    std::array<std::vector<double>, kMetricCount> mean;
+  };
+
+  MetricRollup();
+
+  /** Fold one observation taken at `timestampMs` into every tier. */
+  void record(int64_t timestampMs, const Values& values);
+
+  /**
+   * Buckets overlapping [fromMs, toMs] from the finest tier that still
+   * holds the whole range in at most `maxPoints` buckets, falling back to
+   * the coarsest tier. fromMs <= 0 means the whole session and toMs <= 0
+   * means now. If even the coarsest tier needs more than maxPoints, the
+   * newest maxPoints buckets are returned.
+   */
+  Series query(int64_t fromMs, int64_t toMs, size_t maxPoints) const;
+
+  /** Drop all data. */
+  void clear();
+
+private:
+  struct Stat {
+    float min;
+    float max;
+    double sum;
+  };
+
+  struct Bucket {
+    int64_t startMs;
+    uint32_t count; // 0 = empty slot
+    std::array<Stat, kMetricCount> stats;
+  };
+
+  struct Tier {
+    size_t offset = 0;  // first slot in buckets_
+    size_t head = 0;    // slot of the newest bucket
+    bool empty = true;
+    int64_t evictedStartMs = INT64_MIN; // newest bucket overwritten so far
+  };
+
+  static constexpr size_t kTotalBuckets = [] {
+    size_t total = 0;
+    for (const auto& tier : kTiers) total += tier.capacity;
+    return total;
+  }();
+
+public:
+  static constexpr size_t kMemoryBytes = kTotalBuckets * sizeof(Bucket);
+
+private:
+  void clearLocked();
+  static void startBucket(Bucket& bucket, int64_t startMs);
+
+  mutable std::mutex mutex_;
+  std::vector<Bucket> buckets_; // all tiers back to back, sized once
+  std::array<Tier, kTiers.size()> tiers_;
+};
+
+} // namespace nitroperf
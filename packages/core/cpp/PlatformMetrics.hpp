@@ -3,13 +3,71 @@
 #include <functional>
 #include <memory>
 #include <cstdint>
+#include <vector>
 
 namespace nitroperf {
 
+/**
+ * Where the process's memory lives, in bytes. RSS counts shared library
+ * pages in full for every process mapping them; PSS splits them between
+ * those processes, and swap covers pages compressed into zram, which is
+ * what the low-memory killer weighs. Fields a platform can't measure are 0.
+ */
+struct MemoryBreakdown {
+  int64_t pssBytes;
+  int64_t privateCleanBytes;
+  int64_t privateDirtyBytes;
+  int64_t swapBytes;
+  int64_t anonBytes;  // resident anonymous memory
+  int64_t fileBytes;  // resident file-backed and shmem pages
+};
+
+/** What a thread does for the app, as far as the monitor knows. */
+enum class ThreadRole : uint8_t {
+  kOther,
+  kUi,
+  kJs,
+  kMonitor,
+};
+
+/** One thread's CPU use over a sampling interval. */
+struct ThreadCpu {
+  int32_t tid;
+  ThreadRole role;
+  char state;         // R running, S sleeping, D disk wait, ...
+  int32_t lastCpu;    // core it last ran on
+  double cpuPercent;  // of one core; a thread can't exceed 100
+  char name[16];
+};
+
+/** A thread's scheduler counters, cumulative over its lifetime. */
+struct ThreadSchedStats {
+  int32_t tid;
+  int64_t runNs;                 // on a CPU
+  int64_t runQueueNs;            // runnable, waiting for a CPU
+  uint64_t voluntarySwitches;    // gave the CPU up: blocked or yielded
+  uint64_t involuntarySwitches;  // preempted
+};
+
+/** Page faults of the whole process, cumulative. */
+struct PageFaults {
+  uint64_t minor;  // resolved from memory: first touch, copy-on-write, page cache hit
+  uint64_t major;  // waited for I/O: storage, or zram on Android
+};
+
+/** Process and per-thread CPU use over one sampling interval. */
+struct CpuUsage {
+  double intervalMs = 0.0;
+  double processPercent = 0.0; // summed over cores, so up to 100 × cores
+  std::vector<ThreadCpu> threads;
+};
+
 /**
  * Abstract interface for platform-specific metric collection.
  * iOS: CADisplayLink + Mach APIs
- * Android: Choreographer (via JNI) + /proc/self/status
+ * Android: Choreographer (via JNI) + /proc/self/statm and smaps_rollup
+ *          (see ProcFile.hpp) + /proc/self/task (see ThreadCpuSampler.hpp,
+ *          ThreadSchedSampler.hpp) + getrusage()
  */
 class PlatformMetrics {
 public:
@@ -17,7 +75,8 @@ public:
 
   /**
    * Start tracking UI frame ticks.
-   * @param onTick Called on each UI frame with timestamp in seconds.
+   * @param onTick Called on each UI frame with its timestamp in seconds on
+   *               the monotonic timebase (see Timebase::nowNs()).
    */
   virtual void startUIFPSTracking(std::function<void(double)> onTick) = 0;
 
@@ -27,7 +86,8 @@ public:
   /**
    * Start tracking JS frame ticks (where available natively).
    * On Fabric/Android, JS FPS is tracked from JS-side rAF instead.
-   * @param onTick Called on each JS frame with timestamp in seconds.
+   * @param onTick Called on each JS frame with its timestamp in seconds on
+   *               the monotonic timebase.
    */
   virtual void startJSFPSTracking(std::function<void(double)> onTick) = 0;
 
@@ -37,6 +97,36 @@ public:
   /** Get current process resident memory in bytes. */
   virtual int64_t getResidentMemoryBytes() = 0;
 
+  /**
+   * Detailed memory breakdown. Far more expensive than
+   * getResidentMemoryBytes() on Android (the kernel walks every mapping),
+   * so callers sample it on a slower cadence. Default: all zeros.
+   */
+  virtual MemoryBreakdown getMemoryBreakdown() { return MemoryBreakdown{}; }
+
+  /**
+   * Tag the calling thread with `role` in CPU samples. Cheap enough to
+   * call on every frame batch; a role moves when another thread claims it.
+   */
+  virtual void markCurrentThread(ThreadRole /*role*/) {}
+
+  /**
+   * CPU use since the previous call, reusing `usage`'s storage. Returns
+   * false on the first call (which only sets the baseline) and where
+   * per-thread CPU isn't available. Call from one thread at a time.
+   */
+  virtual bool sampleCpuUsage(CpuUsage& /*usage*/) { return false; }
+
+  /**
+   * Scheduler counters of the thread marked with `role`. False until
+   * such a thread is known, and where the counters aren't available.
+   * Call from one thread at a time.
+   */
+  virtual bool getThreadSchedStats(ThreadRole /*role*/, ThreadSchedStats& /*stats*/) { return false; }
+
+  /** The process's page fault counters; false where unavailable. */
+  virtual bool getPageFaults(PageFaults& /*faults*/) { return false; }
+
   /** Factory: creates the platform-appropriate implementation. */
   static std::unique_ptr<PlatformMetrics> create();
 };
@@ -2,9 +2,12 @@
 
 #if defined(__ANDROID__)
 
-#include <fstream>
-#include <string>
+#include "ProcFile.hpp"
+#include "ThreadCpuSampler.hpp"
+#include "ThreadSchedSampler.hpp"
 #include <jni.h>
+#include <sys/resource.h>
+#include <unistd.h>
 #include <android/log.h>
 
 #define LOG_TAG "NitroPerf"
@@ -32,6 +35,7 @@ JNIEXPORT void JNICALL
 Java_com_nitroperf_PerfMetricsProvider_nativeOnUIFrameTick(
     JNIEnv * /*env*/, jobject /*thiz*/, jlong timestampNanos) {
   if (gUIFrameCallback) {
+    // frameTimeNanos is System.nanoTime(): CLOCK_MONOTONIC, like steady_clock
     double timestampSeconds = static_cast<double>(timestampNanos) / 1e9;
     gUIFrameCallback(timestampSeconds);
   }
@@ -41,6 +45,12 @@ Java_com_nitroperf_PerfMetricsProvider_nativeOnUIFrameTick(
 
 class PlatformMetrics_Android : public PlatformMetrics {
 public:
+  PlatformMetrics_Android() {
+    // Choreographer callbacks run on the main looper, whose tid is the pid
+    cpu_.markThread(ThreadRole::kUi, static_cast<int32_t>(::getpid()));
+    sched_.markThread(ThreadRole::kUi, static_cast<int32_t>(::getpid()));
+  }
+
   void startUIFPSTracking(std::function<void(double)> onTick) override {
     gUIFrameCallback = std::move(onTick);
 
@@ -63,30 +73,46 @@ public:
   }
 
   int64_t getResidentMemoryBytes() override {
-    // Read /proc/self/status for VmRSS
-    std::ifstream status("/proc/self/status");
-    if (!status.is_open()) return 0;
-
-    std::string line;
-    while (std::getline(status, line)) {
-      if (line.compare(0, 6, "VmRSS:") == 0) {
-        // Format: "VmRSS:    12345 kB"
-        size_t pos = 6;
-        while (pos < line.size() && (line[pos] == ' ' || line[pos] == '\t')) {
-          pos++;
-        }
-        int64_t kbValue = 0;
-        while (pos < line.size() && line[pos] >= '0' && line[pos] <= '9') {
-          kbValue = kbValue * 10 + (line[pos] - '0');
-          pos++;
-        }
-        return kbValue * 1024; // Convert kB to bytes
-      }
-    }
-    return 0;
+    return statm_.residentBytes();
+  }
+
+  MemoryBreakdown getMemoryBreakdown() override {
+    MemoryBreakdown breakdown{};
+    smapsRollup_.sample(breakdown);
+    return breakdown;
+  }
+
+  void markCurrentThread(ThreadRole role) override {
+    int32_t tid = static_cast<int32_t>(::gettid());
+    cpu_.markThread(role, tid);
+    sched_.markThread(role, tid);
+  }
+
+  bool sampleCpuUsage(CpuUsage &usage) override {
+    return cpu_.sample(usage);
+  }
+
+  bool getThreadSchedStats(ThreadRole role, ThreadSchedStats &stats) override {
+    return sched_.sample(role, stats);
+  }
+
+  bool getPageFaults(PageFaults &faults) override {
+    // One syscall, no parsing; the same counters as /proc/self/stat,
+    // including threads that have exited
+    rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) return false;
+    faults.minor = static_cast<uint64_t>(usage.ru_minflt);
+    faults.major = static_cast<uint64_t>(usage.ru_majflt);
+    return true;
   }
 
 private:
+  // /proc/self/statm and smaps_rollup stay open; each sample is one pread()
+  StatmSampler statm_;
+  SmapsRollupSampler smapsRollup_;
+  ThreadCpuSampler cpu_;
+  ThreadSchedSampler sched_;
+
   void callJavaMethod(const char *methodName) {
     if (!gJavaVM || !gPerfProvider) return;
 
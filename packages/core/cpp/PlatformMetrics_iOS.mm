@@ -1,8 +1,10 @@
 #import "PlatformMetrics.hpp"
+#import "Timebase.hpp"
 
 #if __APPLE__
 
 #import <Foundation/Foundation.h>
+#import <QuartzCore/CABase.h>
 #import <QuartzCore/CADisplayLink.h>
 #import <mach/mach.h>
 #import <mach/task_info.h>
@@ -30,7 +32,12 @@
 
 - (void)onDisplayLink:(CADisplayLink *)link {
   if (_callback) {
-    _callback(link.timestamp);
+    // link.timestamp is on the CACurrentMediaTime() clock
+    // (mach_absolute_time), which stops while the device sleeps; libc++
+    // steady_clock doesn't. Shift it onto Timebase::nowNs() by the gap
+    // between the two measured now, so it can't drift by the sleep time.
+    double offsetSeconds = static_cast<double>(nitroperf::Timebase::nowNs()) / 1e9 - CACurrentMediaTime();
+    _callback(link.timestamp + offsetSeconds);
   }
 }
 
@@ -111,18 +118,52 @@ public:
 
   int64_t getResidentMemoryBytes() override {
     task_vm_info_data_t vmInfo;
+    if (readVmInfo(vmInfo)) {
+      return static_cast<int64_t>(vmInfo.phys_footprint);
+    }
+    return 0;
+  }
+
+  MemoryBreakdown getMemoryBreakdown() override {
+    // Mach has no PSS or clean/dirty split; report the anon/file split
+    // and the compressor, iOS's counterpart to zram
+    MemoryBreakdown breakdown{};
+    task_vm_info_data_t vmInfo;
+    if (readVmInfo(vmInfo)) {
+      breakdown.swapBytes = static_cast<int64_t>(vmInfo.compressed);
+      breakdown.anonBytes = static_cast<int64_t>(vmInfo.internal);
+      breakdown.fileBytes = static_cast<int64_t>(vmInfo.external);
+    }
+    return breakdown;
+  }
+
+  bool getPageFaults(PageFaults &faults) override {
+    // `faults` counts every fault, `pageins` those that read from disk
+    task_events_info_data_t events;
+    mach_msg_type_number_t count = TASK_EVENTS_INFO_COUNT;
+    kern_return_t kr = task_info(mach_task_self(),
+                                 TASK_EVENTS_INFO,
+                                 reinterpret_cast<task_info_t>(&events),
+                                 &count);
+    if (kr != KERN_SUCCESS) return false;
+    // 32-bit counters; a wrap shows up as a decrease and is skipped
+    uint64_t all = static_cast<uint32_t>(events.faults);
+    uint64_t pageins = static_cast<uint32_t>(events.pageins);
+    faults.major = pageins;
+    faults.minor = all > pageins ? all - pageins : 0;
+    return true;
+  }
+
+private:
+  static bool readVmInfo(task_vm_info_data_t &vmInfo) {
     mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
     kern_return_t kr = task_info(mach_task_self(),
                                  TASK_VM_INFO,
                                  reinterpret_cast<task_info_t>(&vmInfo),
                                  &count);
-    if (kr == KERN_SUCCESS) {
-      return static_cast<int64_t>(vmInfo.phys_footprint);
-    }
-    return 0;
+    return kr == KERN_SUCCESS;
   }
 
-private:
   CADisplayLink *uiDisplayLink_ = nil;
   NitroPerfDisplayLinkTarget *uiTarget_ = nil;
   CADisplayLink *jsDisplayLink_ = nil;
@@ -0,0 +1,172 @@
+#include "ProcFile.hpp"
+
+#if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace nitroperf {
+
+ProcFile::ProcFile(const char* path) {
+  do {
+    fd_ = ::open(path, O_RDONLY | O_CLOEXEC);
+  } while (fd_ < 0 && errno == EINTR);
+}
+
+ProcFile::~ProcFile() {
+  if (fd_ >= 0) ::close(fd_);
+}
+
+long ProcFile::read(char* buffer, size_t capacity) const {
+  if (fd_ < 0 || capacity == 0) return -1;
+
+  // seq_file-backed entries may return less than asked per call; keep
+  // reading until EOF or the buffer is full
+  size_t total = 0;
+  while (total < capacity - 1) {
+    ssize_t n = ::pread(fd_, buffer + total, capacity - 1 - total, static_cast<off_t>(total));
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    if (n == 0) break;
+    total += static_cast<size_t>(n);
+  }
+  buffer[total] = '\0';
+  return static_cast<long>(total);
+}
+
+bool parseNextU64(const char*& cursor, uint64_t& value) {
+  const char* p = cursor;
+  while (*p == ' ' || *p == '\t') p++;
+  if (*p < '0' || *p > '9') return false;
+
+  uint64_t result = 0;
+  while (*p >= '0' && *p <= '9') {
+    result = result * 10 + static_cast<uint64_t>(*p - '0');
+    p++;
+  }
+  value = result;
+  cursor = p;
+  return true;
+}
+
+/** Advance `cursor` past the next space-separated field. */
+static bool skipField(const char*& cursor) {
+  const char* p = cursor;
+  while (*p == ' ') p++;
+  if (*p == '\0' || *p == '\n') return false;
+  while (*p != ' ' && *p != '\0' && *p != '\n') p++;
+  cursor = p;
+  return true;
+}
+
+bool parseTaskStat(const char* buffer, TaskStat& stat) {
+  // "pid (comm) state ppid ...", fields numbered from 1 as in proc(5)
+  const char* open = std::strchr(buffer, '(');
+  const char* close = std::strrchr(buffer, ')');
+  if (open == nullptr || close == nullptr || close < open) return false;
+
+  size_t nameLength = std::min<size_t>(static_cast<size_t>(close - open - 1), sizeof(stat.name) - 1);
+  std::memcpy(stat.name, open + 1, nameLength);
+  stat.name[nameLength] = '\0';
+
+  const char* cursor = close + 1;
+  while (*cursor == ' ') cursor++;
+  if (*cursor == '\0') return false;
+  stat.state = *cursor++;
+
+  uint64_t processor = 0;
+  for (int field = 4; field <= 39; field++) {
+    bool parsed = true;
+    switch (field) {
+      case 10: parsed = parseNextU64(cursor, stat.minorFaults); break;
+      case 12: parsed = parseNextU64(cursor, stat.majorFaults); break;
+      case 14: parsed = parseNextU64(cursor, stat.userTicks); break;
+      case 15: parsed = parseNextU64(cursor, stat.systemTicks); break;
+      case 20: parsed = parseNextU64(cursor, stat.threadCount); break;
+      case 39: parsed = parseNextU64(cursor, processor); break;
+      default: parsed = skipField(cursor); break;
+    }
+    if (!parsed) return false;
+  }
+  stat.processor = static_cast<int32_t>(processor);
+  return true;
+}
+
+StatmSampler::StatmSampler()
+    : statm_("/proc/self/statm"),
+      pageSize_(::sysconf(_SC_PAGESIZE)) {}
+
+int64_t StatmSampler::residentBytes() const {
+  // "size resident shared text lib data dt", in pages
+  char buffer[128];
+  if (statm_.read(buffer, sizeof(buffer)) <= 0) return 0;
+
+  const char* cursor = buffer;
+  uint64_t sizePages = 0, residentPages = 0;
+  if (!parseNextU64(cursor, sizePages) || !parseNextU64(cursor, residentPages)) return 0;
+  return static_cast<int64_t>(residentPages) * pageSize_;
+}
+
+SmapsRollupSampler::SmapsRollupSampler()
+    : rollup_("/proc/self/smaps_rollup") {}
+
+/** If `line` starts with `key` ("Name:"), advance `cursor` past it. */
+static bool matchKey(const char* line, const char* key, size_t keyLength, const char*& cursor) {
+  if (std::strncmp(line, key, keyLength) != 0) return false;
+  cursor = line + keyLength;
+  return true;
+}
+
+bool SmapsRollupSampler::sample(MemoryBreakdown& breakdown) const {
+  // A "[rollup]" header line, then "Name:   <n> kB" lines
+  char buffer[2048];
+  if (rollup_.read(buffer, sizeof(buffer)) <= 0) return false;
+
+  uint64_t rssKb = 0, pssKb = 0, privateCleanKb = 0, privateDirtyKb = 0;
+  uint64_t anonKb = 0, swapKb = 0, swapPssKb = 0;
+  bool hasSwapPss = false;
+  bool hasRss = false;
+
+  for (const char* line = buffer; *line != '\0';) {
+    const char* cursor = nullptr;
+    if (matchKey(line, "Rss:", 4, cursor)) {
+      hasRss = parseNextU64(cursor, rssKb);
+    } else if (matchKey(line, "Pss:", 4, cursor)) {
+      parseNextU64(cursor, pssKb);
+    } else if (matchKey(line, "Private_Clean:", 14, cursor)) {
+      parseNextU64(cursor, privateCleanKb);
+    } else if (matchKey(line, "Private_Dirty:", 14, cursor)) {
+      parseNextU64(cursor, privateDirtyKb);
+    } else if (matchKey(line, "Anonymous:", 10, cursor)) {
+      parseNextU64(cursor, anonKb);
+    } else if (matchKey(line, "Swap:", 5, cursor)) {
+      parseNextU64(cursor, swapKb);
+    } else if (matchKey(line, "SwapPss:", 8, cursor)) {
+      hasSwapPss = parseNextU64(cursor, swapPssKb);
+    }
+
+    const char* newline = std::strchr(line, '\n');
+    if (newline == nullptr) break;
+    line = newline + 1;
+  }
+  if (!hasRss) return false;
+
+  // Rss = Anonymous + file-backed + shmem. SwapPss (4.15+) splits pages
+  // swapped out of shared anonymous mappings like Pss does.
+  breakdown.pssBytes = static_cast<int64_t>(pssKb) * 1024;
+  breakdown.privateCleanBytes = static_cast<int64_t>(privateCleanKb) * 1024;
+  breakdown.privateDirtyBytes = static_cast<int64_t>(privateDirtyKb) * 1024;
+  breakdown.swapBytes = static_cast<int64_t>(hasSwapPss ? swapPssKb : swapKb) * 1024;
+  breakdown.anonBytes = static_cast<int64_t>(anonKb) * 1024;
+  breakdown.fileBytes = static_cast<int64_t>(rssKb > anonKb ? rssKb - anonKb : 0) * 1024;
+  return true;
+}
+
+} // namespace nitroperf
+
+#endif // __linux__
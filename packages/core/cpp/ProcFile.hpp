@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "PlatformMetrics.hpp"
+
+namespace nitroperf {
+
+/**
+ * A Linux /proc file kept open for repeated sampling.
+ *
+ * The descriptor is opened once; each read() is a single pread() at
+ * offset 0 into a caller-provided buffer, which makes the kernel
+ * regenerate the contents. No allocation, no lseek, no reopen. Compiled
+ * only where __linux__ is defined: Android and desktop test rigs.
+ *
+ * Threading: read() may be called from any thread, since pread() doesn't
+ * share a file offset. Construction and destruction are not thread-safe.
+ */
+class ProcFile {
+public:
+  explicit ProcFile(const char* path);
+  ~ProcFile();
+
+  ProcFile(const ProcFile&) = delete;
+  ProcFile& operator=(const ProcFile&) = delete;
+
+  bool isOpen() const { return fd_ >= 0; }
+
+  /**
+   * Read the file into `buffer` and NUL-terminate it. Returns the number
+   * of bytes read (at most capacity - 1, truncating longer files), or -1.
+   */
+  long read(char* buffer, size_t capacity) const;
+
+private:
+  int fd_ = -1;
+};
+
+/**
+ * Parse the next unsigned decimal number at or after `cursor`, skipping
+ * leading spaces and tabs. On success advances `cursor` past it.
+ */
+bool parseNextU64(const char*& cursor, uint64_t& value);
+
+/** The fields of a /proc/<pid>/stat or /proc/<pid>/task/<tid>/stat line we use. */
+struct TaskStat {
+  char name[16];          // comm, NUL-terminated
+  char state;             // R running, S sleeping, D disk wait, ...
+  uint64_t minorFaults;
+  uint64_t majorFaults;
+  uint64_t userTicks;     // utime, in clock ticks
+  uint64_t systemTicks;   // stime, in clock ticks
+  uint64_t threadCount;
+  int32_t processor;      // CPU it last ran on
+};
+
+/**
+ * Parse a stat line. comm may contain spaces and parentheses, so fields
+ * are counted from the last ')'. Returns false on a malformed line.
+ */
+bool parseTaskStat(const char* buffer, TaskStat& stat);
+
+/**
+ * Resident set size from /proc/self/statm. statm is a single line of
+ * page counts, so a sample is one pread() of ~40 bytes and two number
+ * parses instead of scanning /proc/self/status line by line. The value
+ * equals VmRSS (anon + file + shmem).
+ */
+class StatmSampler {
+public:
+  StatmSampler();
+
+  /** Current RSS in bytes; 0 if /proc is unavailable. */
+  int64_t residentBytes() const;
+
+private:
+  ProcFile statm_;
+  int64_t pageSize_;
+};
+
+/**
+ * Memory breakdown from /proc/self/smaps_rollup: the per-mapping
+ * counters of smaps summed by the kernel into one ~1 KB record, parsed
+ * from a stack buffer. Reading it still walks every VMA under the mmap
+ * lock: ~0.1 µs per mapping, a few hundred µs for an app with thousands
+ * of mappings against well under 1 µs for statm. Sample it on its own,
+ * slower cadence. Needs Linux 4.14+; Android
+ * kernels carry it from Android 9.
+ */
+class SmapsRollupSampler {
+public:
+  SmapsRollupSampler();
+
+  /** Fill `breakdown`; false (leaving it untouched) if unavailable. */
+  bool sample(MemoryBreakdown& breakdown) const;
+
+private:
+  ProcFile rollup_;
+};
+
+} // namespace nitroperf
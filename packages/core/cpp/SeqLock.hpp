@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace nitroperf {
+
+/**
+ * Single-writer sequence lock.
+ *
+ * The writer bumps the sequence to an odd value, updates the protected
+ * fields, then bumps it back to even. Readers never block the writer:
+ * they snapshot the sequence, read, and retry if a write overlapped.
+ *
+ * Protected fields must be atomics accessed with memory_order_relaxed so
+ * that overlapping reads are well-defined. Writers must be serialized by
+ * the caller (typically there is exactly one producer thread).
+ */
+class SeqLock {
+public:
+  void beginWrite() noexcept {
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  void endWrite() noexcept {
+    seq_.store(seq_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * Runs `fn` until it observes a state no writer touched concurrently,
+   * then returns its result. `fn` must only perform relaxed atomic loads.
+   */
+  template <typename Fn>
+  auto read(Fn&& fn) const {
+    while (true) {
+      uint64_t before = seq_.load(std::memory_order_acquire);
+      if (before & 1) continue; // Write in progress
+
+      auto result = fn();
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) == before) {
+        return result;
+      }
+    }
+  }
+
+private:
+  std::atomic<uint64_t> seq_{0};
+};
+
+/**
+ * A trivially-copyable value published through a SeqLock.
+ * The value is stored as relaxed atomic words so readers can copy it
+ * while the writer is mid-update and simply retry.
+ */
+template <typename T>
+class SeqLocked {
+  static_assert(std::is_trivially_copyable_v<T>, "SeqLocked<T> requires a trivially copyable T");
+  static_assert(std::is_default_constructible_v<T>, "SeqLocked<T> requires a default constructible T");
+
+public:
+  SeqLocked() { store(T{}); }
+
+  /** Publish a new value. Single writer only. */
+  void store(const T& value) noexcept {
+    uint64_t buffer[kWords] = {};
+    std::memcpy(buffer, &value, sizeof(T));
+    lock_.beginWrite();
+    for (size_t i = 0; i < kWords; i++) {
+      words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    lock_.endWrite();
+  }
+
+  /** Copy out the most recently published value. Never blocks the writer. */
+  T load() const noexcept {
+    return lock_.read([this] {
+      uint64_t buffer[kWords];
+      for (size_t i = 0; i < kWords; i++) {
+        buffer[i] = words_[i].load(std::memory_order_relaxed);
+      }
+      T value;
+      std::memcpy(&value, buffer, sizeof(T));
+      return value;
+    });
+  }
+
+private:
+  static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  SeqLock lock_;
+  std::atomic<uint64_t> words_[kWords] = {};
+};
+
+} // namespace nitroperf
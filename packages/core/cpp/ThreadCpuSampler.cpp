@@ -0,0 +1,125 @@
+#include "ThreadCpuSampler.hpp"
+
+#if defined(__linux__)
+
+#include "Timebase.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <unistd.h>
+
+namespace nitroperf {
+
+ThreadCpuSampler::ThreadCpuSampler()
+    : processStat_("/proc/self/stat"),
+      ticksPerSecond_(static_cast<double>(::sysconf(_SC_CLK_TCK))) {}
+
+void ThreadCpuSampler::markThread(ThreadRole role, int32_t tid) {
+  if (role == ThreadRole::kOther) return;
+  auto& slot = roleTids_[static_cast<size_t>(role)];
+  if (slot.load(std::memory_order_relaxed) != tid) {
+    slot.store(tid, std::memory_order_relaxed);
+    // The thread may not have a descriptor yet (new, or skipped at the cap)
+    rolesChanged_.store(true, std::memory_order_release);
+  }
+}
+
+ThreadRole ThreadCpuSampler::roleOf(int32_t tid) const {
+  for (ThreadRole role : {ThreadRole::kUi, ThreadRole::kJs, ThreadRole::kMonitor}) {
+    if (roleTids_[static_cast<size_t>(role)].load(std::memory_order_relaxed) == tid) return role;
+  }
+  return ThreadRole::kOther;
+}
+
+void ThreadCpuSampler::refreshThreads() {
+  DIR* dir = ::opendir("/proc/self/task");
+  if (dir == nullptr) return;
+  enumerated_.clear();
+  while (const dirent* entry = ::readdir(dir)) {
+    const char* cursor = entry->d_name;
+    uint64_t tid = 0;
+    if (parseNextU64(cursor, tid) && *cursor == '\0') {
+      enumerated_.push_back(static_cast<int32_t>(tid));
+    }
+  }
+  ::closedir(dir);
+  std::sort(enumerated_.begin(), enumerated_.end());
+
+  // Surviving threads keep their descriptor and baseline
+  std::vector<Thread> next;
+  next.reserve(std::min(enumerated_.size(), kMaxThreads));
+  auto previous = threads_.begin();
+  for (int32_t tid : enumerated_) {
+    if (next.size() >= kMaxThreads - kRoleSlots && roleOf(tid) == ThreadRole::kOther) continue;
+
+    while (previous != threads_.end() && previous->tid < tid) ++previous;
+    if (previous != threads_.end() && previous->tid == tid) {
+      next.push_back(std::move(*previous));
+      continue;
+    }
+
+    char path[48];
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/stat", tid);
+    auto stat = std::make_unique<ProcFile>(path);
+    if (!stat->isOpen()) continue; // exited since readdir()
+    next.push_back(Thread{tid, std::move(stat), 0, false});
+  }
+  threads_ = std::move(next);
+  threadsStale_ = false;
+}
+
+bool ThreadCpuSampler::sample(CpuUsage& usage) {
+  // A stat line is ~300 bytes
+  char buffer[512];
+  TaskStat process;
+  if (processStat_.read(buffer, sizeof(buffer)) <= 0 || !parseTaskStat(buffer, process)) return false;
+  int64_t nowNs = Timebase::nowNs();
+
+  bool rolesChanged = rolesChanged_.exchange(false, std::memory_order_acquire);
+  if (threadsStale_ || rolesChanged || process.threadCount != enumeratedThreadCount_) {
+    refreshThreads();
+    enumeratedThreadCount_ = process.threadCount;
+  }
+
+  bool hasBaseline = lastSampleNs_ != 0;
+  double intervalTicks = static_cast<double>(nowNs - lastSampleNs_) / 1e9 * ticksPerSecond_;
+  auto percentSince = [&](uint64_t ticks, uint64_t previousTicks) {
+    if (!hasBaseline || !(intervalTicks > 0) || ticks < previousTicks) return 0.0;
+    return static_cast<double>(ticks - previousTicks) * 100.0 / intervalTicks;
+  };
+
+  usage.threads.clear();
+  for (Thread& thread : threads_) {
+    TaskStat stat;
+    if (thread.stat->read(buffer, sizeof(buffer)) <= 0 || !parseTaskStat(buffer, stat)) {
+      threadsStale_ = true; // exited; dropped at the next enumeration
+      continue;
+    }
+    uint64_t ticks = stat.userTicks + stat.systemTicks;
+
+    ThreadCpu cpu{};
+    cpu.tid = thread.tid;
+    cpu.role = roleOf(thread.tid);
+    cpu.state = stat.state;
+    cpu.lastCpu = stat.processor;
+    cpu.cpuPercent = thread.baseline ? percentSince(ticks, thread.ticks) : 0.0;
+    std::memcpy(cpu.name, stat.name, sizeof(cpu.name));
+    usage.threads.push_back(cpu);
+
+    thread.ticks = ticks;
+    thread.baseline = true;
+  }
+
+  // The process counters include threads that have already exited
+  uint64_t processTicks = process.userTicks + process.systemTicks;
+  usage.processPercent = percentSince(processTicks, processTicks_);
+  usage.intervalMs = hasBaseline ? static_cast<double>(nowNs - lastSampleNs_) / 1e6 : 0.0;
+  processTicks_ = processTicks;
+  lastSampleNs_ = nowNs;
+  return hasBaseline;
+}
+
+} // namespace nitroperf
+
+#endif // __linux__
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "PlatformMetrics.hpp"
+#include "ProcFile.hpp"
+
+namespace nitroperf {
+
+/**
+ * Per-thread CPU use from /proc/self/task/<tid>/stat.
+ *
+ * Each thread's stat file is opened once and re-read with pread(), and
+ * utime + stime are differenced against the previous sample. The thread
+ * list is enumerated from /proc/self/task only when num_threads in
+ * /proc/self/stat changes or a thread's file stops reading (it exited),
+ * so a steady-state sample is one pread() per thread plus one for the
+ * process, with no allocation. Times are in clock ticks (10 ms on
+ * Android), so a 500 ms interval resolves 2% of a core.
+ *
+ * Costs one descriptor per thread, capped at kMaxThreads; threads over
+ * the cap still count towards the process total. kRoleSlots of the cap
+ * are held back for role threads, and marking a new role thread forces
+ * a re-enumeration, so a role thread is tracked from the next sample
+ * even when the process is over the cap.
+ *
+ * Threading: markThread() may be called from any thread. sample() must
+ * be called from one thread at a time (the monitor's timer thread).
+ */
+class ThreadCpuSampler {
+public:
+  static constexpr size_t kMaxThreads = 256;
+  // One per role other than kOther
+  static constexpr size_t kRoleSlots = 3;
+
+  ThreadCpuSampler();
+
+  /** Attribute `tid` to `role` from the next sample on. */
+  void markThread(ThreadRole role, int32_t tid);
+
+  /** See PlatformMetrics::sampleCpuUsage(). */
+  bool sample(CpuUsage& usage);
+
+private:
+  struct Thread {
+    int32_t tid;
+    std::unique_ptr<ProcFile> stat;
+    uint64_t ticks;  // utime + stime at the previous sample
+    bool baseline;   // false until `ticks` has been read once
+  };
+
+  void refreshThreads();
+  ThreadRole roleOf(int32_t tid) const;
+
+  ProcFile processStat_;
+  double ticksPerSecond_;
+
+  std::vector<Thread> threads_;         // sorted by tid
+  std::vector<int32_t> enumerated_;     // refreshThreads() scratch
+  uint64_t enumeratedThreadCount_ = 0;  // num_threads at the last enumeration
+  bool threadsStale_ = true;
+  std::atomic<bool> rolesChanged_{false}; // set by markThread()
+
+  uint64_t processTicks_ = 0;
+  int64_t lastSampleNs_ = 0; // 0 = no baseline yet
+
+  // Indexed by ThreadRole; 0 = unknown
+  std::array<std::atomic<int32_t>, 4> roleTids_{};
+};
+
+} // namespace nitroperf
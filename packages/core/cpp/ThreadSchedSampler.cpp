@@ -0,0 +1,66 @@
+#include "ThreadSchedSampler.hpp"
+
+#if defined(__linux__)
+
+#include <cstdio>
+#include <cstring>
+
+namespace nitroperf {
+
+void ThreadSchedSampler::markThread(ThreadRole role, int32_t tid) {
+  if (role == ThreadRole::kOther) return;
+  auto& slot = roleTids_[static_cast<size_t>(role)];
+  if (slot.load(std::memory_order_relaxed) != tid) {
+    slot.store(tid, std::memory_order_relaxed);
+  }
+}
+
+/** Value of the "key:\t<n>" line of a status file, or false. */
+static bool findStatusValue(const char* buffer, const char* key, uint64_t& value) {
+  const char* line = std::strstr(buffer, key);
+  if (line == nullptr) return false;
+  const char* cursor = line + std::strlen(key);
+  return parseNextU64(cursor, value);
+}
+
+bool ThreadSchedSampler::sample(ThreadRole role, ThreadSchedStats& stats) {
+  if (role == ThreadRole::kOther) return false;
+  int32_t tid = roleTids_[static_cast<size_t>(role)].load(std::memory_order_relaxed);
+  if (tid == 0) return false;
+
+  RoleFiles& files = files_[static_cast<size_t>(role)];
+  if (files.tid != tid) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/schedstat", tid);
+    files.schedstat = std::make_unique<ProcFile>(path);
+    std::snprintf(path, sizeof(path), "/proc/self/task/%d/status", tid);
+    files.status = std::make_unique<ProcFile>(path);
+    files.tid = tid;
+  }
+
+  // "<run ns> <run queue ns> <timeslices>"
+  char buffer[4096];
+  uint64_t runNs = 0, runQueueNs = 0;
+  if (files.schedstat->read(buffer, sizeof(buffer)) <= 0) return false;
+  const char* cursor = buffer;
+  if (!parseNextU64(cursor, runNs) || !parseNextU64(cursor, runQueueNs)) return false;
+
+  // status is ~1.5 KB of "Name:\tvalue" lines, the switch counts last
+  uint64_t voluntary = 0, involuntary = 0;
+  if (files.status->read(buffer, sizeof(buffer)) <= 0) return false;
+  if (!findStatusValue(buffer, "\nvoluntary_ctxt_switches:", voluntary) ||
+      !findStatusValue(buffer, "\nnonvoluntary_ctxt_switches:", involuntary)) {
+    return false;
+  }
+
+  stats.tid = tid;
+  stats.runNs = static_cast<int64_t>(runNs);
+  stats.runQueueNs = static_cast<int64_t>(runQueueNs);
+  stats.voluntarySwitches = voluntary;
+  stats.involuntarySwitches = involuntary;
+  return true;
+}
+
+} // namespace nitroperf
+
+#endif // __linux__
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "PlatformMetrics.hpp"
+#include "ProcFile.hpp"
+
+namespace nitroperf {
+
+/**
+ * Scheduler counters of the role threads (UI, JS, monitor) from
+ * /proc/self/task/<tid>/schedstat and status.
+ *
+ * schedstat gives the time a thread spent on a CPU and waiting in a run
+ * queue, in ns; status adds voluntary and involuntary context switches.
+ * A thread that keeps getting preempted and waits long in the run queue
+ * is starved of CPU rather than doing too much work. Both files stay
+ * open per role and are reopened when another thread takes the role.
+ * A sample is two pread()s, ~7 µs.
+ *
+ * Threading: markThread() may be called from any thread. sample() must
+ * be called from one thread at a time.
+ */
+class ThreadSchedSampler {
+public:
+  /** Attribute `tid` to `role` from the next sample on. */
+  void markThread(ThreadRole role, int32_t tid);
+
+  /** See PlatformMetrics::getThreadSchedStats(). */
+  bool sample(ThreadRole role, ThreadSchedStats& stats);
+
+private:
+  struct RoleFiles {
+    int32_t tid = 0;
+    std::unique_ptr<ProcFile> schedstat;
+    std::unique_ptr<ProcFile> status;
+  };
+
+  // Indexed by ThreadRole; 0 = unknown
+  std::array<std::atomic<int32_t>, 4> roleTids_{};
+  std::array<RoleFiles, 4> files_; // sample() only
+};
+
+} // namespace nitroperf
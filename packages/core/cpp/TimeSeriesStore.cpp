@@ -0,0 +1,92 @@
+#include "TimeSeriesStore.hpp"
+#include <algorithm>
+
+namespace nitroperf {
+
+TimeSeriesStore::TimeSeriesStore(size_t columnCount, size_t timeColumn, size_t capacity)
+    : columnCount_(columnCount),
+      timeColumn_(timeColumn),
+      capacity_(std::max<size_t>(capacity, 1)),
+      data_(columnCount * std::max<size_t>(capacity, 1), 0.0) {}
+
+void TimeSeriesStore::append(const double* row) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  size_t target;
+  if (size_ < capacity_) {
+    target = slot(size_);
+    size_++;
+  } else {
+    // Full: overwrite the oldest row
+    target = head_;
+    head_ = (head_ + 1) % capacity_;
+  }
+  for (size_t c = 0; c < columnCount_; c++) {
+    column(c)[target] = row[c];
+  }
+}
+
+TimeSeriesStore::Range TimeSeriesStore::query(double fromTime, double toTime,
+                                              uint64_t columnMask, size_t maxRows) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Range range;
+
+  // Binary search over logical (oldest-first) positions
+  const double* times = column(timeColumn_);
+  auto firstAtLeast = [&](double time, bool inclusive) {
+    size_t lo = 0, hi = size_;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      double value = times[slot(mid)];
+      if (inclusive ? value < time : value <= time) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  };
+  size_t begin = firstAtLeast(fromTime, true);
+  size_t end = toTime > 0 ? firstAtLeast(toTime, false) : size_;
+  if (end <= begin) return range;
+  if (maxRows > 0 && end - begin > maxRows) {
+    begin = end - maxRows;
+  }
+
+  range.rows = end - begin;
+  // The logical range is at most two contiguous runs of the ring
+  size_t first = slot(begin);
+  size_t firstRun = std::min(range.rows, capacity_ - first);
+  auto copyColumn = [&](const double* source, std::vector<double>& out) {
+    out.insert(out.end(), source + first, source + first + firstRun);
+    out.insert(out.end(), source, source + (range.rows - firstRun));
+  };
+
+  range.timestamps.reserve(range.rows);
+  copyColumn(times, range.timestamps);
+
+  size_t selected = 0;
+  for (size_t c = 0; c < columnCount_ && c < 64; c++) {
+    if (c != timeColumn_ && (columnMask & (uint64_t{1} << c))) selected++;
+  }
+  range.values.reserve(selected * range.rows);
+  for (size_t c = 0; c < columnCount_ && c < 64; c++) {
+    if (c != timeColumn_ && (columnMask & (uint64_t{1} << c))) {
+      copyColumn(column(c), range.values);
+    }
+  }
+  return range;
+}
+
+void TimeSeriesStore::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  head_ = 0;
+  size_ = 0;
+}
+
+size_t TimeSeriesStore::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+} // namespace nitroperf
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace nitroperf {
+
+/**
+ * Fixed-capacity struct-of-arrays ring of numeric rows.
+ *
+ * Each column is one contiguous array inside a single allocation made at
+ * construction; one designated column holds the timestamp every other
+ * column is indexed by. When full, the oldest row is overwritten.
+ * Timestamps are expected to be non-decreasing, so range queries are a
+ * binary search plus a copy of only the selected columns.
+ *
+ * Threading: append(), query() and clear() may be called from any thread
+ * and are serialized by an internal mutex. append() is O(columns).
+ */
+class TimeSeriesStore {
+public:
+  /** Rows of a query, oldest first, copied column-wise. */
+  struct Range {
+    size_t rows = 0;
+    std::vector<double> timestamps;
+    std::vector<double> values; // column-major: `rows` values per selected column
+  };
+
+  TimeSeriesStore(size_t columnCount, size_t timeColumn, size_t capacity);
+
+  /** Append one row of `columnCount()` values. */
+  void append(const double* row);
+
+  /**
+   * Rows with fromTime <= timestamp <= toTime (toTime <= 0 = no upper
+   * bound), keeping only the newest `maxRows` (0 = no limit). Columns
+   * whose bit is set in `columnMask` are copied, in column order; the
+   * time column is always returned as `timestamps` and never duplicated
+   * into `values`.
+   */
+  Range query(double fromTime, double toTime, uint64_t columnMask, size_t maxRows) const;
+
+  /** Drop all rows. */
+  void clear();
+
+  size_t columnCount() const { return columnCount_; }
+  size_t capacity() const { return capacity_; }
+  size_t size() const;
+
+private:
+  /** Physical slot of the i-th oldest row. */
+  size_t slot(size_t logical) const { return (head_ + logical) % capacity_; }
+  const double* column(size_t index) const { return data_.data() + index * capacity_; }
+  double* column(size_t index) { return data_.data() + index * capacity_; }
+
+  const size_t columnCount_;
+  const size_t timeColumn_;
+  const size_t capacity_;
+
+  mutable std::mutex mutex_;
+  std::vector<double> data_; // columnCount_ columns of capacity_ values
+  size_t head_ = 0;          // slot of the oldest row
+  size_t size_ = 0;
+};
+
+} // namespace nitroperf
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace nitroperf {
+
+/**
+ * The single monotonic nanosecond timebase every metric is recorded in.
+ *
+ * nowNs() is std::chrono::steady_clock. On Android that is
+ * CLOCK_MONOTONIC, the clock of Choreographer frameTimeNanos, so UI frames
+ * arrive on it directly. On Apple it is CLOCK_MONOTONIC_RAW, which keeps
+ * counting while the device sleeps, unlike the mach_absolute_time clock
+ * of CADisplayLink.timestamp; the iOS layer shifts link timestamps onto
+ * nowNs() as they arrive. Two calibrated offsets map it to other clocks:
+ *
+ * - Wall time: sampled once at construction and never again, so wall
+ *   timestamps derived from it never jump, whether NTP adjusts the system
+ *   clock or not, and a timestamp maps to the same wall time however
+ *   late it is converted.
+ * - JS performance.now(): each calibrateJs() call measures
+ *   steady - performance.now(); the smallest measurement (least call
+ *   latency) wins. A measurement far from the current one means a new JS
+ *   runtime with a new origin and replaces it.
+ *
+ * Threading: all methods may be called from any thread.
+ */
+class Timebase {
+public:
+  Timebase() {
+    int64_t wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+    wallOffsetNs_.store(wallNs - nowNs(), std::memory_order_relaxed);
+  }
+
+  /** Current monotonic time in nanoseconds. */
+  static int64_t nowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /** Unix epoch milliseconds for a monotonic timestamp. */
+  double toWallMs(int64_t monotonicNs) const noexcept {
+    return static_cast<double>(monotonicNs + wallOffsetNs_.load(std::memory_order_relaxed)) / 1e6;
+  }
+
+  double nowWallMs() const noexcept { return toWallMs(nowNs()); }
+
+  /** Wall clock minus monotonic clock, in ms: wallMs = monotonicNs / 1e6 + this. */
+  double wallOffsetMs() const noexcept {
+    return static_cast<double>(wallOffsetNs_.load(std::memory_order_relaxed)) / 1e6;
+  }
+
+  /**
+   * Record a performance.now() value read on the JS thread immediately
+   * before this call.
+   */
+  void calibrateJs(double performanceNowMs) noexcept {
+    int64_t measured = nowNs() - std::llround(performanceNowMs * 1e6);
+    int64_t current = jsOffsetNs_.load(std::memory_order_relaxed);
+    while (true) {
+      bool newOrigin = current == kUncalibrated || std::llabs(measured - current) > kNewOriginNs;
+      if (!newOrigin && measured >= current) return;
+      if (jsOffsetNs_.compare_exchange_weak(current, measured, std::memory_order_relaxed)) return;
+    }
+  }
+
+  bool isJsCalibrated() const noexcept {
+    return jsOffsetNs_.load(std::memory_order_relaxed) != kUncalibrated;
+  }
+
+  /**
+   * Offset in ms such that monotonicMs = performanceNowMs + this; 0 until
+   * calibrateJs() has been called.
+   */
+  double jsOffsetMs() const noexcept {
+    int64_t offset = jsOffsetNs_.load(std::memory_order_relaxed);
+    return offset == kUncalibrated ? 0.0 : static_cast<double>(offset) / 1e6;
+  }
+
+private:
+  static constexpr int64_t kUncalibrated = INT64_MIN;
+  // A JSI call takes microseconds; a jump this large is a different origin
+  static constexpr int64_t kNewOriginNs = 50'000'000;
+
+  std::atomic<int64_t> wallOffsetNs_{0};
+  std::atomic<int64_t> jsOffsetNs_{kUncalibrated};
+};
+
+} // namespace nitroperf
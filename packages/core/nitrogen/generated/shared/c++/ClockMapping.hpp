@@ -0,0 +1,95 @@
+///
+/// ClockMapping.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ClockMapping).
+   */
+  struct ClockMapping final {
+  public:
+    double monotonicNowNs     SWIFT_PRIVATE;
+    double wallClockOffsetMs     SWIFT_PRIVATE;
+    double jsClockOffsetMs     SWIFT_PRIVATE;
+    bool jsCalibrated     SWIFT_PRIVATE;
+
+  public:
+    ClockMapping() = default;
+    explicit ClockMapping(double monotonicNowNs, double wallClockOffsetMs, double jsClockOffsetMs, bool jsCalibrated): monotonicNowNs(monotonicNowNs), wallClockOffsetMs(wallClockOffsetMs), jsClockOffsetMs(jsClockOffsetMs), jsCalibrated(jsCalibrated) {}
+
+  public:
+    friend bool operator==(const ClockMapping& lhs, const ClockMapping& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ ClockMapping <> JS ClockMapping (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::ClockMapping> final {
+    static inline margelo::nitro::nitroperf::ClockMapping fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::ClockMapping(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "monotonicNowNs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wallClockOffsetMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsClockOffsetMs"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsCalibrated")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::ClockMapping& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "monotonicNowNs"), JSIConverter<double>::toJSI(runtime, arg.monotonicNowNs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "wallClockOffsetMs"), JSIConverter<double>::toJSI(runtime, arg.wallClockOffsetMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsClockOffsetMs"), JSIConverter<double>::toJSI(runtime, arg.jsClockOffsetMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsCalibrated"), JSIConverter<bool>::toJSI(runtime, arg.jsCalibrated));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "monotonicNowNs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wallClockOffsetMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsClockOffsetMs")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsCalibrated")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,119 @@
+///
+/// ComponentRenderStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ComponentRenderStats).
+   */
+  struct ComponentRenderStats final {
+  public:
+    std::string componentId     SWIFT_PRIVATE;
+    double renderCount     SWIFT_PRIVATE;
+    double countError     SWIFT_PRIVATE;
+    double totalDurationMs     SWIFT_PRIVATE;
+    double avgDurationMs     SWIFT_PRIVATE;
+    double maxDurationMs     SWIFT_PRIVATE;
+    double lastDurationMs     SWIFT_PRIVATE;
+    double mountCount     SWIFT_PRIVATE;
+    double updateCount     SWIFT_PRIVATE;
+    double nestedUpdateCount     SWIFT_PRIVATE;
+
+  public:
+    ComponentRenderStats() = default;
+    explicit ComponentRenderStats(std::string componentId, double renderCount, double countError, double totalDurationMs, double avgDurationMs, double maxDurationMs, double lastDurationMs, double mountCount, double updateCount, double nestedUpdateCount): componentId(componentId), renderCount(renderCount), countError(countError), totalDurationMs(totalDurationMs), avgDurationMs(avgDurationMs), maxDurationMs(maxDurationMs), lastDurationMs(lastDurationMs), mountCount(mountCount), updateCount(updateCount), nestedUpdateCount(nestedUpdateCount) {}
+
+  public:
+    friend bool operator==(const ComponentRenderStats& lhs, const ComponentRenderStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ ComponentRenderStats <> JS ComponentRenderStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::ComponentRenderStats> final {
+    static inline margelo::nitro::nitroperf::ComponentRenderStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::ComponentRenderStats(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "componentId"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renderCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "countError"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "totalDurationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "avgDurationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxDurationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lastDurationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mountCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "updateCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nestedUpdateCount")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::ComponentRenderStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "componentId"), JSIConverter<std::string>::toJSI(runtime, arg.componentId));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "renderCount"), JSIConverter<double>::toJSI(runtime, arg.renderCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "countError"), JSIConverter<double>::toJSI(runtime, arg.countError));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "totalDurationMs"), JSIConverter<double>::toJSI(runtime, arg.totalDurationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "avgDurationMs"), JSIConverter<double>::toJSI(runtime, arg.avgDurationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxDurationMs"), JSIConverter<double>::toJSI(runtime, arg.maxDurationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lastDurationMs"), JSIConverter<double>::toJSI(runtime, arg.lastDurationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "mountCount"), JSIConverter<double>::toJSI(runtime, arg.mountCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "updateCount"), JSIConverter<double>::toJSI(runtime, arg.updateCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "nestedUpdateCount"), JSIConverter<double>::toJSI(runtime, arg.nestedUpdateCount));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "componentId")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renderCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "countError")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "totalDurationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "avgDurationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxDurationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lastDurationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mountCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "updateCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nestedUpdateCount")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,92 @@
+///
+/// DistributionSet.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `DurationDistribution` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct DurationDistribution; }
+
+#include "DurationDistribution.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DistributionSet).
+   */
+  struct DistributionSet final {
+  public:
+    DurationDistribution longTasks     SWIFT_PRIVATE;
+    DurationDistribution slowEvents     SWIFT_PRIVATE;
+    DurationDistribution renders     SWIFT_PRIVATE;
+
+  public:
+    DistributionSet() = default;
+    explicit DistributionSet(DurationDistribution longTasks, DurationDistribution slowEvents, DurationDistribution renders): longTasks(longTasks), slowEvents(slowEvents), renders(renders) {}
+
+  public:
+    friend bool operator==(const DistributionSet& lhs, const DistributionSet& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ DistributionSet <> JS DistributionSet (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::DistributionSet> final {
+    static inline margelo::nitro::nitroperf::DistributionSet fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::DistributionSet(
+        JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "longTasks"))),
+        JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "slowEvents"))),
+        JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renders")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::DistributionSet& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "longTasks"), JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::toJSI(runtime, arg.longTasks));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "slowEvents"), JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::toJSI(runtime, arg.slowEvents));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "renders"), JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::toJSI(runtime, arg.renders));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "longTasks")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "slowEvents")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::DurationDistribution>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renders")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
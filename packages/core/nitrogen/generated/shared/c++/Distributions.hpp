@@ -0,0 +1,92 @@
+///
+/// Distributions.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `DistributionSet` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct DistributionSet; }
+
+#include "DistributionSet.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (Distributions).
+   */
+  struct Distributions final {
+  public:
+    DistributionSet total     SWIFT_PRIVATE;
+    DistributionSet interval     SWIFT_PRIVATE;
+    double intervalMs     SWIFT_PRIVATE;
+
+  public:
+    Distributions() = default;
+    explicit Distributions(DistributionSet total, DistributionSet interval, double intervalMs): total(total), interval(interval), intervalMs(intervalMs) {}
+
+  public:
+    friend bool operator==(const Distributions& lhs, const Distributions& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ Distributions <> JS Distributions (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::Distributions> final {
+    static inline margelo::nitro::nitroperf::Distributions fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::Distributions(
+        JSIConverter<margelo::nitro::nitroperf::DistributionSet>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total"))),
+        JSIConverter<margelo::nitro::nitroperf::DistributionSet>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "interval"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "intervalMs")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::Distributions& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "total"), JSIConverter<margelo::nitro::nitroperf::DistributionSet>::toJSI(runtime, arg.total));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "interval"), JSIConverter<margelo::nitro::nitroperf::DistributionSet>::toJSI(runtime, arg.interval));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "intervalMs"), JSIConverter<double>::toJSI(runtime, arg.intervalMs));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::nitroperf::DistributionSet>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::DistributionSet>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "interval")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "intervalMs")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
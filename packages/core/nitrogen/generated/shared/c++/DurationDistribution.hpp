@@ -0,0 +1,123 @@
+///
+/// DurationDistribution.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DurationDistribution).
+   */
+  struct DurationDistribution final {
+  public:
+    double count     SWIFT_PRIVATE;
+    double sumMs     SWIFT_PRIVATE;
+    double meanMs     SWIFT_PRIVATE;
+    double p50Ms     SWIFT_PRIVATE;
+    double p90Ms     SWIFT_PRIVATE;
+    double p95Ms     SWIFT_PRIVATE;
+    double p99Ms     SWIFT_PRIVATE;
+    double maxMs     SWIFT_PRIVATE;
+    std::vector<double> bucketStartsMs     SWIFT_PRIVATE;
+    std::vector<double> bucketWidthsMs     SWIFT_PRIVATE;
+    std::vector<double> bucketCounts     SWIFT_PRIVATE;
+
+  public:
+    DurationDistribution() = default;
+    explicit DurationDistribution(double count, double sumMs, double meanMs, double p50Ms, double p90Ms, double p95Ms, double p99Ms, double maxMs, std::vector<double> bucketStartsMs, std::vector<double> bucketWidthsMs, std::vector<double> bucketCounts): count(count), sumMs(sumMs), meanMs(meanMs), p50Ms(p50Ms), p90Ms(p90Ms), p95Ms(p95Ms), p99Ms(p99Ms), maxMs(maxMs), bucketStartsMs(bucketStartsMs), bucketWidthsMs(bucketWidthsMs), bucketCounts(bucketCounts) {}
+
+  public:
+    friend bool operator==(const DurationDistribution& lhs, const DurationDistribution& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ DurationDistribution <> JS DurationDistribution (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::DurationDistribution> final {
+    static inline margelo::nitro::nitroperf::DurationDistribution fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::DurationDistribution(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "count"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sumMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p95Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxMs"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketStartsMs"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketWidthsMs"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketCounts")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::DurationDistribution& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "count"), JSIConverter<double>::toJSI(runtime, arg.count));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "sumMs"), JSIConverter<double>::toJSI(runtime, arg.sumMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "meanMs"), JSIConverter<double>::toJSI(runtime, arg.meanMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p50Ms"), JSIConverter<double>::toJSI(runtime, arg.p50Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p90Ms"), JSIConverter<double>::toJSI(runtime, arg.p90Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p95Ms"), JSIConverter<double>::toJSI(runtime, arg.p95Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p99Ms"), JSIConverter<double>::toJSI(runtime, arg.p99Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxMs"), JSIConverter<double>::toJSI(runtime, arg.maxMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "bucketStartsMs"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.bucketStartsMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "bucketWidthsMs"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.bucketWidthsMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "bucketCounts"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.bucketCounts));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "count")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sumMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p95Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxMs")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketStartsMs")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketWidthsMs")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bucketCounts")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,107 @@
+///
+/// FPSHistoryBuffer.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FPSHistoryBuffer).
+   */
+  struct FPSHistoryBuffer final {
+  public:
+    std::shared_ptr<ArrayBuffer> uiFpsSamples     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> jsFpsSamples     SWIFT_PRIVATE;
+    double uiFpsMin     SWIFT_PRIVATE;
+    double uiFpsMax     SWIFT_PRIVATE;
+    double jsFpsMin     SWIFT_PRIVATE;
+    double jsFpsMax     SWIFT_PRIVATE;
+    double generation     SWIFT_PRIVATE;
+
+  public:
+    FPSHistoryBuffer() = default;
+    explicit FPSHistoryBuffer(std::shared_ptr<ArrayBuffer> uiFpsSamples, std::shared_ptr<ArrayBuffer> jsFpsSamples, double uiFpsMin, double uiFpsMax, double jsFpsMin, double jsFpsMax, double generation): uiFpsSamples(uiFpsSamples), jsFpsSamples(jsFpsSamples), uiFpsMin(uiFpsMin), uiFpsMax(uiFpsMax), jsFpsMin(jsFpsMin), jsFpsMax(jsFpsMax), generation(generation) {}
+
+  public:
+    friend bool operator==(const FPSHistoryBuffer& lhs, const FPSHistoryBuffer& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ FPSHistoryBuffer <> JS FPSHistoryBuffer (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::FPSHistoryBuffer> final {
+    static inline margelo::nitro::nitroperf::FPSHistoryBuffer fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::FPSHistoryBuffer(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples"))),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "generation")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::FPSHistoryBuffer& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.uiFpsSamples));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.jsFpsSamples));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin"), JSIConverter<double>::toJSI(runtime, arg.uiFpsMin));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax"), JSIConverter<double>::toJSI(runtime, arg.uiFpsMax));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin"), JSIConverter<double>::toJSI(runtime, arg.jsFpsMin));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax"), JSIConverter<double>::toJSI(runtime, arg.jsFpsMax));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "generation"), JSIConverter<double>::toJSI(runtime, arg.generation));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples")))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "generation")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
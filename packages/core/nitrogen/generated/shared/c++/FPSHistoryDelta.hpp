@@ -0,0 +1,125 @@
+///
+/// FPSHistoryDelta.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HistoryCursor` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct HistoryCursor; }
+
+#include <vector>
+#include "HistoryCursor.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FPSHistoryDelta).
+   */
+  struct FPSHistoryDelta final {
+  public:
+    std::vector<double> uiFpsSamples     SWIFT_PRIVATE;
+    std::vector<double> jsFpsSamples     SWIFT_PRIVATE;
+    double uiMissed     SWIFT_PRIVATE;
+    double jsMissed     SWIFT_PRIVATE;
+    bool uiReset     SWIFT_PRIVATE;
+    bool jsReset     SWIFT_PRIVATE;
+    HistoryCursor cursor     SWIFT_PRIVATE;
+    double uiFpsMin     SWIFT_PRIVATE;
+    double uiFpsMax     SWIFT_PRIVATE;
+    double jsFpsMin     SWIFT_PRIVATE;
+    double jsFpsMax     SWIFT_PRIVATE;
+
+  public:
+    FPSHistoryDelta() = default;
+    explicit FPSHistoryDelta(std::vector<double> uiFpsSamples, std::vector<double> jsFpsSamples, double uiMissed, double jsMissed, bool uiReset, bool jsReset, HistoryCursor cursor, double uiFpsMin, double uiFpsMax, double jsFpsMin, double jsFpsMax): uiFpsSamples(uiFpsSamples), jsFpsSamples(jsFpsSamples), uiMissed(uiMissed), jsMissed(jsMissed), uiReset(uiReset), jsReset(jsReset), cursor(cursor), uiFpsMin(uiFpsMin), uiFpsMax(uiFpsMax), jsFpsMin(jsFpsMin), jsFpsMax(jsFpsMax) {}
+
+  public:
+    friend bool operator==(const FPSHistoryDelta& lhs, const FPSHistoryDelta& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ FPSHistoryDelta <> JS FPSHistoryDelta (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::FPSHistoryDelta> final {
+    static inline margelo::nitro::nitroperf::FPSHistoryDelta fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::FPSHistoryDelta(
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiReset"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsReset"))),
+        JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::FPSHistoryDelta& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.uiFpsSamples));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.jsFpsSamples));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"), JSIConverter<double>::toJSI(runtime, arg.uiMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"), JSIConverter<double>::toJSI(runtime, arg.jsMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiReset"), JSIConverter<bool>::toJSI(runtime, arg.uiReset));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsReset"), JSIConverter<bool>::toJSI(runtime, arg.jsReset));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cursor"), JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::toJSI(runtime, arg.cursor));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin"), JSIConverter<double>::toJSI(runtime, arg.uiFpsMin));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax"), JSIConverter<double>::toJSI(runtime, arg.uiFpsMax));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin"), JSIConverter<double>::toJSI(runtime, arg.jsFpsMin));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax"), JSIConverter<double>::toJSI(runtime, arg.jsFpsMax));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsSamples")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsSamples")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiReset")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsReset")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMin")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFpsMax")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMin")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFpsMax")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
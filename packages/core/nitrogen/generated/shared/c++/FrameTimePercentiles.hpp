@@ -0,0 +1,88 @@
+///
+/// FrameTimePercentiles.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `FrameTimeStats` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct FrameTimeStats; }
+
+#include "FrameTimeStats.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameTimePercentiles).
+   */
+  struct FrameTimePercentiles final {
+  public:
+    FrameTimeStats ui     SWIFT_PRIVATE;
+    FrameTimeStats js     SWIFT_PRIVATE;
+
+  public:
+    FrameTimePercentiles() = default;
+    explicit FrameTimePercentiles(FrameTimeStats ui, FrameTimeStats js): ui(ui), js(js) {}
+
+  public:
+    friend bool operator==(const FrameTimePercentiles& lhs, const FrameTimePercentiles& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ FrameTimePercentiles <> JS FrameTimePercentiles (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::FrameTimePercentiles> final {
+    static inline margelo::nitro::nitroperf::FrameTimePercentiles fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::FrameTimePercentiles(
+        JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ui"))),
+        JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "js")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::FrameTimePercentiles& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ui"), JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::toJSI(runtime, arg.ui));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "js"), JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::toJSI(runtime, arg.js));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ui")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::FrameTimeStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "js")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,107 @@
+///
+/// FrameTimeStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (FrameTimeStats).
+   */
+  struct FrameTimeStats final {
+  public:
+    double frameCount     SWIFT_PRIVATE;
+    double meanMs     SWIFT_PRIVATE;
+    double p50Ms     SWIFT_PRIVATE;
+    double p90Ms     SWIFT_PRIVATE;
+    double p99Ms     SWIFT_PRIVATE;
+    double p999Ms     SWIFT_PRIVATE;
+    double maxMs     SWIFT_PRIVATE;
+
+  public:
+    FrameTimeStats() = default;
+    explicit FrameTimeStats(double frameCount, double meanMs, double p50Ms, double p90Ms, double p99Ms, double p999Ms, double maxMs): frameCount(frameCount), meanMs(meanMs), p50Ms(p50Ms), p90Ms(p90Ms), p99Ms(p99Ms), p999Ms(p999Ms), maxMs(maxMs) {}
+
+  public:
+    friend bool operator==(const FrameTimeStats& lhs, const FrameTimeStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ FrameTimeStats <> JS FrameTimeStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::FrameTimeStats> final {
+    static inline margelo::nitro::nitroperf::FrameTimeStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::FrameTimeStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p999Ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxMs")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::FrameTimeStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "frameCount"), JSIConverter<double>::toJSI(runtime, arg.frameCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "meanMs"), JSIConverter<double>::toJSI(runtime, arg.meanMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p50Ms"), JSIConverter<double>::toJSI(runtime, arg.p50Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p90Ms"), JSIConverter<double>::toJSI(runtime, arg.p90Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p99Ms"), JSIConverter<double>::toJSI(runtime, arg.p99Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "p999Ms"), JSIConverter<double>::toJSI(runtime, arg.p999Ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxMs"), JSIConverter<double>::toJSI(runtime, arg.maxMs));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "meanMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p50Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p90Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p99Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "p999Ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxMs")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -15,16 +15,38 @@ namespace margelo::nitro::nitroperf {
     // load custom methods/properties
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridGetter("isRunning", &HybridPerfMonitorSpec::getIsRunning);
+      prototype.registerHybridGetter("historyGeneration", &HybridPerfMonitorSpec::getHistoryGeneration);
       prototype.registerHybridMethod("start", &HybridPerfMonitorSpec::start);
       prototype.registerHybridMethod("stop", &HybridPerfMonitorSpec::stop);
       prototype.registerHybridMethod("getMetrics", &HybridPerfMonitorSpec::getMetrics);
       prototype.registerHybridMethod("getHistory", &HybridPerfMonitorSpec::getHistory);
+      prototype.registerHybridMethod("getHistoryBuffer", &HybridPerfMonitorSpec::getHistoryBuffer);
+      prototype.registerHybridMethod("getHistorySince", &HybridPerfMonitorSpec::getHistorySince);
+      prototype.registerHybridMethod("getRollups", &HybridPerfMonitorSpec::getRollups);
+      prototype.registerHybridMethod("getSnapshotRange", &HybridPerfMonitorSpec::getSnapshotRange);
+      prototype.registerHybridMethod("getFrameTimePercentiles", &HybridPerfMonitorSpec::getFrameTimePercentiles);
+      prototype.registerHybridMethod("getDistributions", &HybridPerfMonitorSpec::getDistributions);
+      prototype.registerHybridMethod("getThreadCpuUsage", &HybridPerfMonitorSpec::getThreadCpuUsage);
+      prototype.registerHybridMethod("setRawFrameCapture", &HybridPerfMonitorSpec::setRawFrameCapture);
+      prototype.registerHybridMethod("getRawFramesSince", &HybridPerfMonitorSpec::getRawFramesSince);
+      prototype.registerHybridMethod("getStutterEpisodesSince", &HybridPerfMonitorSpec::getStutterEpisodesSince);
       prototype.registerHybridMethod("subscribe", &HybridPerfMonitorSpec::subscribe);
+      prototype.registerHybridMethod("subscribeFields", &HybridPerfMonitorSpec::subscribeFields);
+      prototype.registerHybridMethod("subscribeChanges", &HybridPerfMonitorSpec::subscribeChanges);
+      prototype.registerHybridMethod("subscribeStutters", &HybridPerfMonitorSpec::subscribeStutters);
+      prototype.registerHybridMethod("subscribeJank", &HybridPerfMonitorSpec::subscribeJank);
       prototype.registerHybridMethod("unsubscribe", &HybridPerfMonitorSpec::unsubscribe);
       prototype.registerHybridMethod("reportJsFrameTick", &HybridPerfMonitorSpec::reportJsFrameTick);
+      prototype.registerHybridMethod("reportJsFrameTicks", &HybridPerfMonitorSpec::reportJsFrameTicks);
+      prototype.registerHybridMethod("calibrateJsClock", &HybridPerfMonitorSpec::calibrateJsClock);
+      prototype.registerHybridMethod("getClockMapping", &HybridPerfMonitorSpec::getClockMapping);
       prototype.registerHybridMethod("reportLongTask", &HybridPerfMonitorSpec::reportLongTask);
       prototype.registerHybridMethod("reportSlowEvent", &HybridPerfMonitorSpec::reportSlowEvent);
       prototype.registerHybridMethod("reportRender", &HybridPerfMonitorSpec::reportRender);
+      prototype.registerHybridMethod("registerComponent", &HybridPerfMonitorSpec::registerComponent);
+      prototype.registerHybridMethod("reportComponentRender", &HybridPerfMonitorSpec::reportComponentRender);
+      prototype.registerHybridMethod("getComponentRenderStats", &HybridPerfMonitorSpec::getComponentRenderStats);
+      prototype.registerHybridMethod("resetComponentRenderStats", &HybridPerfMonitorSpec::resetComponentRenderStats);
       prototype.registerHybridMethod("reportJsHeap", &HybridPerfMonitorSpec::reportJsHeap);
       prototype.registerHybridMethod("configure", &HybridPerfMonitorSpec::configure);
       prototype.registerHybridMethod("reset", &HybridPerfMonitorSpec::reset);
@@ -17,12 +17,58 @@
 namespace margelo::nitro::nitroperf { struct PerfSnapshot; }
 // Forward declaration of `FPSHistory` to properly resolve imports.
 namespace margelo::nitro::nitroperf { struct FPSHistory; }
+// Forward declaration of `FPSHistoryBuffer` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct FPSHistoryBuffer; }
+// Forward declaration of `HistoryCursor` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct HistoryCursor; }
+// Forward declaration of `FPSHistoryDelta` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct FPSHistoryDelta; }
+// Forward declaration of `MetricRollups` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct MetricRollups; }
+// Forward declaration of `SnapshotSeries` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct SnapshotSeries; }
+// Forward declaration of `FrameTimePercentiles` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct FrameTimePercentiles; }
+// Forward declaration of `Distributions` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct Distributions; }
+// Forward declaration of `ThreadCpuUsage` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct ThreadCpuUsage; }
+// Forward declaration of `RawFrameTimestamps` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct RawFrameTimestamps; }
+// Forward declaration of `StutterEpisodes` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct StutterEpisodes; }
+// Forward declaration of `StutterEpisode` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct StutterEpisode; }
+// Forward declaration of `JankEvent` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct JankEvent; }
+// Forward declaration of `ClockMapping` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct ClockMapping; }
+// Forward declaration of `ComponentRenderStats` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct ComponentRenderStats; }
 // Forward declaration of `PerfConfig` to properly resolve imports.
 namespace margelo::nitro::nitroperf { struct PerfConfig; }
 
 #include "PerfSnapshot.hpp"
 #include "FPSHistory.hpp"
+#include "FPSHistoryBuffer.hpp"
+#include "HistoryCursor.hpp"
+#include "FPSHistoryDelta.hpp"
+#include "MetricRollups.hpp"
+#include "SnapshotSeries.hpp"
+#include "FrameTimePercentiles.hpp"
+#include "Distributions.hpp"
+#include "ThreadCpuUsage.hpp"
+#include "RawFrameTimestamps.hpp"
+#include "StutterEpisodes.hpp"
 #include <functional>
+#include <optional>
+#include <vector>
+#include "StutterEpisode.hpp"
+#include "JankEvent.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include "ClockMapping.hpp"
+#include <string>
+#include "ComponentRenderStats.hpp"
 #include "PerfConfig.hpp"
 
 namespace margelo::nitro::nitroperf {
@@ -53,6 +99,7 @@ namespace margelo::nitro::nitroperf {
     public:
       // Properties
       virtual bool getIsRunning() = 0;
+      virtual double getHistoryGeneration() = 0;
 
     public:
       // Methods
@@ -60,12 +107,33 @@ namespace margelo::nitro::nitroperf {
       virtual void stop() = 0;
       virtual PerfSnapshot getMetrics() = 0;
       virtual FPSHistory getHistory() = 0;
-      virtual double subscribe(const std::function<void(const PerfSnapshot& /* m */)>& cb) = 0;
+      virtual FPSHistoryBuffer getHistoryBuffer() = 0;
+      virtual FPSHistoryDelta getHistorySince(const HistoryCursor& cursor) = 0;
+      virtual MetricRollups getRollups(double fromMs, double toMs, double maxPoints) = 0;
+      virtual SnapshotSeries getSnapshotRange(double fromMs, double toMs, double fieldMask, double maxRows) = 0;
+      virtual FrameTimePercentiles getFrameTimePercentiles() = 0;
+      virtual Distributions getDistributions() = 0;
+      virtual ThreadCpuUsage getThreadCpuUsage() = 0;
+      virtual void setRawFrameCapture(double capacity) = 0;
+      virtual RawFrameTimestamps getRawFramesSince(const HistoryCursor& cursor) = 0;
+      virtual StutterEpisodes getStutterEpisodesSince(const HistoryCursor& cursor) = 0;
+      virtual double subscribe(const std::function<void(const PerfSnapshot& /* m */)>& cb, const std::optional<double>& intervalMs) = 0;
+      virtual double subscribeFields(double fieldMask, double intervalMs, const std::function<void(const std::vector<double>& /* values */)>& cb) = 0;
+      virtual double subscribeChanges(double fieldMask, double intervalMs, double heartbeatMs, const std::vector<double>& epsilons, const std::function<void(double /* changedMask */, const std::vector<double>& /* values */)>& cb) = 0;
+      virtual double subscribeStutters(const std::function<void(const std::vector<StutterEpisode>& /* episodes */)>& cb) = 0;
+      virtual double subscribeJank(const std::function<void(const JankEvent& /* event */)>& cb) = 0;
       virtual void unsubscribe(double id) = 0;
       virtual void reportJsFrameTick(double ts) = 0;
+      virtual void reportJsFrameTicks(const std::shared_ptr<ArrayBuffer>& timestamps, double count) = 0;
+      virtual void calibrateJsClock(double performanceNowMs) = 0;
+      virtual ClockMapping getClockMapping() = 0;
       virtual void reportLongTask(double durationMs) = 0;
       virtual void reportSlowEvent(double durationMs) = 0;
       virtual void reportRender(double actualDurationMs) = 0;
+      virtual double registerComponent(const std::string& name) = 0;
+      virtual void reportComponentRender(double componentId, double phase, double actualDurationMs) = 0;
+      virtual std::vector<ComponentRenderStats> getComponentRenderStats(double maxCount) = 0;
+      virtual void resetComponentRenderStats() = 0;
       virtual void reportJsHeap(double usedBytes, double totalBytes) = 0;
       virtual void configure(const PerfConfig& config) = 0;
       virtual void reset() = 0;
@@ -0,0 +1,111 @@
+///
+/// JankEvent.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (JankEvent).
+   */
+  struct JankEvent final {
+  public:
+    std::string thread     SWIFT_PRIVATE;
+    double frameEndMs     SWIFT_PRIVATE;
+    double frameMs     SWIFT_PRIVATE;
+    double framesSkipped     SWIFT_PRIVATE;
+    bool episodeStart     SWIFT_PRIVATE;
+    bool overThreshold     SWIFT_PRIVATE;
+    double latencyMs     SWIFT_PRIVATE;
+    double coalesced     SWIFT_PRIVATE;
+
+  public:
+    JankEvent() = default;
+    explicit JankEvent(std::string thread, double frameEndMs, double frameMs, double framesSkipped, bool episodeStart, bool overThreshold, double latencyMs, double coalesced): thread(thread), frameEndMs(frameEndMs), frameMs(frameMs), framesSkipped(framesSkipped), episodeStart(episodeStart), overThreshold(overThreshold), latencyMs(latencyMs), coalesced(coalesced) {}
+
+  public:
+    friend bool operator==(const JankEvent& lhs, const JankEvent& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ JankEvent <> JS JankEvent (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::JankEvent> final {
+    static inline margelo::nitro::nitroperf::JankEvent fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::JankEvent(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameEndMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "episodeStart"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "overThreshold"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "latencyMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "coalesced")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::JankEvent& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "thread"), JSIConverter<std::string>::toJSI(runtime, arg.thread));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "frameEndMs"), JSIConverter<double>::toJSI(runtime, arg.frameEndMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "frameMs"), JSIConverter<double>::toJSI(runtime, arg.frameMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped"), JSIConverter<double>::toJSI(runtime, arg.framesSkipped));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "episodeStart"), JSIConverter<bool>::toJSI(runtime, arg.episodeStart));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "overThreshold"), JSIConverter<bool>::toJSI(runtime, arg.overThreshold));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "latencyMs"), JSIConverter<double>::toJSI(runtime, arg.latencyMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "coalesced"), JSIConverter<double>::toJSI(runtime, arg.coalesced));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameEndMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "frameMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "episodeStart")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "overThreshold")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "latencyMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "coalesced")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
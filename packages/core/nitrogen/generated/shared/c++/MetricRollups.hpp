@@ -0,0 +1,113 @@
+///
+/// MetricRollups.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `RollupStats` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct RollupStats; }
+
+#include <vector>
+#include "RollupStats.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (MetricRollups).
+   */
+  struct MetricRollups final {
+  public:
+    double resolutionMs     SWIFT_PRIVATE;
+    std::vector<double> timestamps     SWIFT_PRIVATE;
+    std::vector<double> counts     SWIFT_PRIVATE;
+    RollupStats uiFps     SWIFT_PRIVATE;
+    RollupStats jsFps     SWIFT_PRIVATE;
+    RollupStats ramBytes     SWIFT_PRIVATE;
+    RollupStats jsHeapUsedBytes     SWIFT_PRIVATE;
+    RollupStats droppedFrames     SWIFT_PRIVATE;
+
+  public:
+    MetricRollups() = default;
+    explicit MetricRollups(double resolutionMs, std::vector<double> timestamps, std::vector<double> counts, RollupStats uiFps, RollupStats jsFps, RollupStats ramBytes, RollupStats jsHeapUsedBytes, RollupStats droppedFrames): resolutionMs(resolutionMs), timestamps(timestamps), counts(counts), uiFps(uiFps), jsFps(jsFps), ramBytes(ramBytes), jsHeapUsedBytes(jsHeapUsedBytes), droppedFrames(droppedFrames) {}
+
+  public:
+    friend bool operator==(const MetricRollups& lhs, const MetricRollups& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ MetricRollups <> JS MetricRollups (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::MetricRollups> final {
+    static inline margelo::nitro::nitroperf::MetricRollups fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::MetricRollups(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "resolutionMs"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timestamps"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "counts"))),
+        JSIConverter<margelo::nitro::nitroperf::RollupStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFps"))),
+        JSIConverter<margelo::nitro::nitroperf::RollupStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFps"))),
+        JSIConverter<margelo::nitro::nitroperf::RollupStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ramBytes"))),
+        JSIConverter<margelo::nitro::nitroperf::RollupStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsHeapUsedBytes"))),
+        JSIConverter<margelo::nitro::nitroperf::RollupStats>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::MetricRollups& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "resolutionMs"), JSIConverter<double>::toJSI(runtime, arg.resolutionMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "timestamps"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.timestamps));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "counts"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.counts));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiFps"), JSIConverter<margelo::nitro::nitroperf::RollupStats>::toJSI(runtime, arg.uiFps));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsFps"), JSIConverter<margelo::nitro::nitroperf::RollupStats>::toJSI(runtime, arg.jsFps));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ramBytes"), JSIConverter<margelo::nitro::nitroperf::RollupStats>::toJSI(runtime, arg.ramBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsHeapUsedBytes"), JSIConverter<margelo::nitro::nitroperf::RollupStats>::toJSI(runtime, arg.jsHeapUsedBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames"), JSIConverter<margelo::nitro::nitroperf::RollupStats>::toJSI(runtime, arg.droppedFrames));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "resolutionMs")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timestamps")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "counts")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::RollupStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiFps")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::RollupStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsFps")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::RollupStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ramBytes")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::RollupStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsHeapUsedBytes")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::RollupStats>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "droppedFrames")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -30,7 +30,7 @@
 
 
 
-
+#include <optional>
 
 namespace margelo::nitro::nitroperf {
 
@@ -42,10 +42,13 @@ namespace margelo::nitro::nitroperf {
     double updateIntervalMs     SWIFT_PRIVATE;
     double maxHistorySamples     SWIFT_PRIVATE;
     double targetFps     SWIFT_PRIVATE;
+    std::optional<double> stutterMergeGapMs     SWIFT_PRIVATE;
+    std::optional<double> jankThresholdMs     SWIFT_PRIVATE;
+    std::optional<double> memoryBreakdownIntervalMs     SWIFT_PRIVATE;
 
   public:
     PerfConfig() = default;
-    explicit PerfConfig(double updateIntervalMs, double maxHistorySamples, double targetFps): updateIntervalMs(updateIntervalMs), maxHistorySamples(maxHistorySamples), targetFps(targetFps) {}
+    explicit PerfConfig(double updateIntervalMs, double maxHistorySamples, double targetFps, std::optional<double> stutterMergeGapMs, std::optional<double> jankThresholdMs, std::optional<double> memoryBreakdownIntervalMs): updateIntervalMs(updateIntervalMs), maxHistorySamples(maxHistorySamples), targetFps(targetFps), stutterMergeGapMs(stutterMergeGapMs), jankThresholdMs(jankThresholdMs), memoryBreakdownIntervalMs(memoryBreakdownIntervalMs) {}
 
   public:
     friend bool operator==(const PerfConfig& lhs, const PerfConfig& rhs) = default;
@@ -63,7 +66,10 @@ namespace margelo::nitro {
       return margelo::nitro::nitroperf::PerfConfig(
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "updateIntervalMs"))),
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxHistorySamples"))),
-        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "targetFps")))
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "targetFps"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "stutterMergeGapMs"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jankThresholdMs"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "memoryBreakdownIntervalMs")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::PerfConfig& arg) {
@@ -71,6 +77,9 @@ namespace margelo::nitro {
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "updateIntervalMs"), JSIConverter<double>::toJSI(runtime, arg.updateIntervalMs));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxHistorySamples"), JSIConverter<double>::toJSI(runtime, arg.maxHistorySamples));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "targetFps"), JSIConverter<double>::toJSI(runtime, arg.targetFps));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "stutterMergeGapMs"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.stutterMergeGapMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jankThresholdMs"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.jankThresholdMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "memoryBreakdownIntervalMs"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.memoryBreakdownIntervalMs));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -84,6 +93,9 @@ namespace margelo::nitro {
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "updateIntervalMs")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxHistorySamples")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "targetFps")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "stutterMergeGapMs")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jankThresholdMs")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "memoryBreakdownIntervalMs")))) return false;
       return true;
     }
   };
@@ -53,10 +53,29 @@ namespace margelo::nitro::nitroperf {
     double maxEventDurationMs     SWIFT_PRIVATE;
     double renderCount     SWIFT_PRIVATE;
     double lastRenderDurationMs     SWIFT_PRIVATE;
+    double refreshRateHz     SWIFT_PRIVATE;
+    double schedulerLatenessMs     SWIFT_PRIVATE;
+    double pssBytes     SWIFT_PRIVATE;
+    double privateCleanBytes     SWIFT_PRIVATE;
+    double privateDirtyBytes     SWIFT_PRIVATE;
+    double swapBytes     SWIFT_PRIVATE;
+    double anonBytes     SWIFT_PRIVATE;
+    double fileBytes     SWIFT_PRIVATE;
+    double processCpuPercent     SWIFT_PRIVATE;
+    double uiCpuPercent     SWIFT_PRIVATE;
+    double jsCpuPercent     SWIFT_PRIVATE;
+    double uiRunQueueMsPerSec     SWIFT_PRIVATE;
+    double jsRunQueueMsPerSec     SWIFT_PRIVATE;
+    double uiPreemptionsPerSec     SWIFT_PRIVATE;
+    double jsPreemptionsPerSec     SWIFT_PRIVATE;
+    double uiVoluntarySwitchesPerSec     SWIFT_PRIVATE;
+    double jsVoluntarySwitchesPerSec     SWIFT_PRIVATE;
+    double minorFaultsPerSec     SWIFT_PRIVATE;
+    double majorFaultsPerSec     SWIFT_PRIVATE;
 
   public:
     PerfSnapshot() = default;
-    explicit PerfSnapshot(double uiFps, double jsFps, double ramBytes, double jsHeapUsedBytes, double jsHeapTotalBytes, double droppedFrames, double stutterCount, double timestamp, double longTaskCount, double longTaskTotalMs, double slowEventCount, double maxEventDurationMs, double renderCount, double lastRenderDurationMs): uiFps(uiFps), jsFps(jsFps), ramBytes(ramBytes), jsHeapUsedBytes(jsHeapUsedBytes), jsHeapTotalBytes(jsHeapTotalBytes), droppedFrames(droppedFrames), stutterCount(stutterCount), timestamp(timestamp), longTaskCount(longTaskCount), longTaskTotalMs(longTaskTotalMs), slowEventCount(slowEventCount), maxEventDurationMs(maxEventDurationMs), renderCount(renderCount), lastRenderDurationMs(lastRenderDurationMs) {}
+    explicit PerfSnapshot(double uiFps, double jsFps, double ramBytes, double jsHeapUsedBytes, double jsHeapTotalBytes, double droppedFrames, double stutterCount, double timestamp, double longTaskCount, double longTaskTotalMs, double slowEventCount, double maxEventDurationMs, double renderCount, double lastRenderDurationMs, double refreshRateHz, double schedulerLatenessMs, double pssBytes, double privateCleanBytes, double privateDirtyBytes, double swapBytes, double anonBytes, double fileBytes, double processCpuPercent, double uiCpuPercent, double jsCpuPercent, double uiRunQueueMsPerSec, double jsRunQueueMsPerSec, double uiPreemptionsPerSec, double jsPreemptionsPerSec, double uiVoluntarySwitchesPerSec, double jsVoluntarySwitchesPerSec, double minorFaultsPerSec, double majorFaultsPerSec): uiFps(uiFps), jsFps(jsFps), ramBytes(ramBytes), jsHeapUsedBytes(jsHeapUsedBytes), jsHeapTotalBytes(jsHeapTotalBytes), droppedFrames(droppedFrames), stutterCount(stutterCount), timestamp(timestamp), longTaskCount(longTaskCount), longTaskTotalMs(longTaskTotalMs), slowEventCount(slowEventCount), maxEventDurationMs(maxEventDurationMs), renderCount(renderCount), lastRenderDurationMs(lastRenderDurationMs), refreshRateHz(refreshRateHz), schedulerLatenessMs(schedulerLatenessMs), pssBytes(pssBytes), privateCleanBytes(privateCleanBytes), privateDirtyBytes(privateDirtyBytes), swapBytes(swapBytes), anonBytes(anonBytes), fileBytes(fileBytes), processCpuPercent(processCpuPercent), uiCpuPercent(uiCpuPercent), jsCpuPercent(jsCpuPercent), uiRunQueueMsPerSec(uiRunQueueMsPerSec), jsRunQueueMsPerSec(jsRunQueueMsPerSec), uiPreemptionsPerSec(uiPreemptionsPerSec), jsPreemptionsPerSec(jsPreemptionsPerSec), uiVoluntarySwitchesPerSec(uiVoluntarySwitchesPerSec), jsVoluntarySwitchesPerSec(jsVoluntarySwitchesPerSec), minorFaultsPerSec(minorFaultsPerSec), majorFaultsPerSec(majorFaultsPerSec) {}
 
   public:
     friend bool operator==(const PerfSnapshot& lhs, const PerfSnapshot& rhs) = default;
@@ -85,7 +104,26 @@ namespace margelo::nitro {
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "slowEventCount"))),
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxEventDurationMs"))),
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renderCount"))),
-        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lastRenderDurationMs")))
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lastRenderDurationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "refreshRateHz"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "schedulerLatenessMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pssBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "privateCleanBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "privateDirtyBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "swapBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "anonBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "fileBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiCpuPercent"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsCpuPercent"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiRunQueueMsPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsRunQueueMsPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiPreemptionsPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsPreemptionsPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiVoluntarySwitchesPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsVoluntarySwitchesPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minorFaultsPerSec"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "majorFaultsPerSec")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::PerfSnapshot& arg) {
@@ -104,6 +142,25 @@ namespace margelo::nitro {
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxEventDurationMs"), JSIConverter<double>::toJSI(runtime, arg.maxEventDurationMs));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "renderCount"), JSIConverter<double>::toJSI(runtime, arg.renderCount));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "lastRenderDurationMs"), JSIConverter<double>::toJSI(runtime, arg.lastRenderDurationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "refreshRateHz"), JSIConverter<double>::toJSI(runtime, arg.refreshRateHz));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "schedulerLatenessMs"), JSIConverter<double>::toJSI(runtime, arg.schedulerLatenessMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "pssBytes"), JSIConverter<double>::toJSI(runtime, arg.pssBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "privateCleanBytes"), JSIConverter<double>::toJSI(runtime, arg.privateCleanBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "privateDirtyBytes"), JSIConverter<double>::toJSI(runtime, arg.privateDirtyBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "swapBytes"), JSIConverter<double>::toJSI(runtime, arg.swapBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "anonBytes"), JSIConverter<double>::toJSI(runtime, arg.anonBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "fileBytes"), JSIConverter<double>::toJSI(runtime, arg.fileBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent"), JSIConverter<double>::toJSI(runtime, arg.processCpuPercent));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiCpuPercent"), JSIConverter<double>::toJSI(runtime, arg.uiCpuPercent));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsCpuPercent"), JSIConverter<double>::toJSI(runtime, arg.jsCpuPercent));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiRunQueueMsPerSec"), JSIConverter<double>::toJSI(runtime, arg.uiRunQueueMsPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsRunQueueMsPerSec"), JSIConverter<double>::toJSI(runtime, arg.jsRunQueueMsPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiPreemptionsPerSec"), JSIConverter<double>::toJSI(runtime, arg.uiPreemptionsPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsPreemptionsPerSec"), JSIConverter<double>::toJSI(runtime, arg.jsPreemptionsPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiVoluntarySwitchesPerSec"), JSIConverter<double>::toJSI(runtime, arg.uiVoluntarySwitchesPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsVoluntarySwitchesPerSec"), JSIConverter<double>::toJSI(runtime, arg.jsVoluntarySwitchesPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "minorFaultsPerSec"), JSIConverter<double>::toJSI(runtime, arg.minorFaultsPerSec));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "majorFaultsPerSec"), JSIConverter<double>::toJSI(runtime, arg.majorFaultsPerSec));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -128,6 +185,25 @@ namespace margelo::nitro {
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxEventDurationMs")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "renderCount")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lastRenderDurationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "refreshRateHz")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "schedulerLatenessMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "pssBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "privateCleanBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "privateDirtyBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "swapBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "anonBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "fileBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiCpuPercent")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsCpuPercent")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiRunQueueMsPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsRunQueueMsPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiPreemptionsPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsPreemptionsPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiVoluntarySwitchesPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsVoluntarySwitchesPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minorFaultsPerSec")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "majorFaultsPerSec")))) return false;
       return true;
     }
   };
@@ -0,0 +1,101 @@
+///
+/// RawFrameTimestamps.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HistoryCursor` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct HistoryCursor; }
+
+#include <NitroModules/ArrayBuffer.hpp>
+#include "HistoryCursor.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RawFrameTimestamps).
+   */
+  struct RawFrameTimestamps final {
+  public:
+    std::shared_ptr<ArrayBuffer> uiTimestampsNs     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> jsTimestampsNs     SWIFT_PRIVATE;
+    double uiMissed     SWIFT_PRIVATE;
+    double jsMissed     SWIFT_PRIVATE;
+    HistoryCursor cursor     SWIFT_PRIVATE;
+
+  public:
+    RawFrameTimestamps() = default;
+    explicit RawFrameTimestamps(std::shared_ptr<ArrayBuffer> uiTimestampsNs, std::shared_ptr<ArrayBuffer> jsTimestampsNs, double uiMissed, double jsMissed, HistoryCursor cursor): uiTimestampsNs(uiTimestampsNs), jsTimestampsNs(jsTimestampsNs), uiMissed(uiMissed), jsMissed(jsMissed), cursor(cursor) {}
+
+  public:
+    friend bool operator==(const RawFrameTimestamps& lhs, const RawFrameTimestamps& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ RawFrameTimestamps <> JS RawFrameTimestamps (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::RawFrameTimestamps> final {
+    static inline margelo::nitro::nitroperf::RawFrameTimestamps fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::RawFrameTimestamps(
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiTimestampsNs"))),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsTimestampsNs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"))),
+        JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::RawFrameTimestamps& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiTimestampsNs"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.uiTimestampsNs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsTimestampsNs"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.jsTimestampsNs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"), JSIConverter<double>::toJSI(runtime, arg.uiMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"), JSIConverter<double>::toJSI(runtime, arg.jsMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cursor"), JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::toJSI(runtime, arg.cursor));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiTimestampsNs")))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsTimestampsNs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
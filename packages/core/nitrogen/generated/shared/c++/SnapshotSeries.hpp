@@ -0,0 +1,95 @@
+///
+/// SnapshotSeries.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <NitroModules/ArrayBuffer.hpp>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (SnapshotSeries).
+   */
+  struct SnapshotSeries final {
+  public:
+    double fieldMask     SWIFT_PRIVATE;
+    double rows     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> timestamps     SWIFT_PRIVATE;
+    std::shared_ptr<ArrayBuffer> values     SWIFT_PRIVATE;
+
+  public:
+    SnapshotSeries() = default;
+    explicit SnapshotSeries(double fieldMask, double rows, std::shared_ptr<ArrayBuffer> timestamps, std::shared_ptr<ArrayBuffer> values): fieldMask(fieldMask), rows(rows), timestamps(timestamps), values(values) {}
+
+  public:
+    friend bool operator==(const SnapshotSeries& lhs, const SnapshotSeries& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ SnapshotSeries <> JS SnapshotSeries (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::SnapshotSeries> final {
+    static inline margelo::nitro::nitroperf::SnapshotSeries fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::SnapshotSeries(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "fieldMask"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rows"))),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timestamps"))),
+        JSIConverter<std::shared_ptr<ArrayBuffer>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "values")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::SnapshotSeries& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "fieldMask"), JSIConverter<double>::toJSI(runtime, arg.fieldMask));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "rows"), JSIConverter<double>::toJSI(runtime, arg.rows));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "timestamps"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.timestamps));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "values"), JSIConverter<std::shared_ptr<ArrayBuffer>>::toJSI(runtime, arg.values));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "fieldMask")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "rows")))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timestamps")))) return false;
+      if (!JSIConverter<std::shared_ptr<ArrayBuffer>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "values")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,123 @@
+///
+/// StutterEpisode.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (StutterEpisode).
+   */
+  struct StutterEpisode final {
+  public:
+    std::string thread     SWIFT_PRIVATE;
+    double startMs     SWIFT_PRIVATE;
+    double endMs     SWIFT_PRIVATE;
+    double durationMs     SWIFT_PRIVATE;
+    double framesSkipped     SWIFT_PRIVATE;
+    double worstFrameMs     SWIFT_PRIVATE;
+    double slowFrames     SWIFT_PRIVATE;
+    double runningMs     SWIFT_PRIVATE;
+    double runQueueMs     SWIFT_PRIVATE;
+    double minorFaults     SWIFT_PRIVATE;
+    double majorFaults     SWIFT_PRIVATE;
+
+  public:
+    StutterEpisode() = default;
+    explicit StutterEpisode(std::string thread, double startMs, double endMs, double durationMs, double framesSkipped, double worstFrameMs, double slowFrames, double runningMs, double runQueueMs, double minorFaults, double majorFaults): thread(thread), startMs(startMs), endMs(endMs), durationMs(durationMs), framesSkipped(framesSkipped), worstFrameMs(worstFrameMs), slowFrames(slowFrames), runningMs(runningMs), runQueueMs(runQueueMs), minorFaults(minorFaults), majorFaults(majorFaults) {}
+
+  public:
+    friend bool operator==(const StutterEpisode& lhs, const StutterEpisode& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ StutterEpisode <> JS StutterEpisode (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::StutterEpisode> final {
+    static inline margelo::nitro::nitroperf::StutterEpisode fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::StutterEpisode(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "startMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "endMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "durationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "worstFrameMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "slowFrames"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "runningMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "runQueueMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minorFaults"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "majorFaults")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::StutterEpisode& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "thread"), JSIConverter<std::string>::toJSI(runtime, arg.thread));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "startMs"), JSIConverter<double>::toJSI(runtime, arg.startMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "endMs"), JSIConverter<double>::toJSI(runtime, arg.endMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "durationMs"), JSIConverter<double>::toJSI(runtime, arg.durationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped"), JSIConverter<double>::toJSI(runtime, arg.framesSkipped));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "worstFrameMs"), JSIConverter<double>::toJSI(runtime, arg.worstFrameMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "slowFrames"), JSIConverter<double>::toJSI(runtime, arg.slowFrames));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "runningMs"), JSIConverter<double>::toJSI(runtime, arg.runningMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "runQueueMs"), JSIConverter<double>::toJSI(runtime, arg.runQueueMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "minorFaults"), JSIConverter<double>::toJSI(runtime, arg.minorFaults));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "majorFaults"), JSIConverter<double>::toJSI(runtime, arg.majorFaults));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "startMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "endMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "durationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "framesSkipped")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "worstFrameMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "slowFrames")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "runningMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "runQueueMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "minorFaults")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "majorFaults")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,100 @@
+///
+/// StutterEpisodes.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `StutterEpisode` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct StutterEpisode; }
+// Forward declaration of `HistoryCursor` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct HistoryCursor; }
+
+#include "StutterEpisode.hpp"
+#include <vector>
+#include "HistoryCursor.hpp"
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (StutterEpisodes).
+   */
+  struct StutterEpisodes final {
+  public:
+    std::vector<StutterEpisode> episodes     SWIFT_PRIVATE;
+    double uiMissed     SWIFT_PRIVATE;
+    double jsMissed     SWIFT_PRIVATE;
+    HistoryCursor cursor     SWIFT_PRIVATE;
+
+  public:
+    StutterEpisodes() = default;
+    explicit StutterEpisodes(std::vector<StutterEpisode> episodes, double uiMissed, double jsMissed, HistoryCursor cursor): episodes(episodes), uiMissed(uiMissed), jsMissed(jsMissed), cursor(cursor) {}
+
+  public:
+    friend bool operator==(const StutterEpisodes& lhs, const StutterEpisodes& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ StutterEpisodes <> JS StutterEpisodes (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::StutterEpisodes> final {
+    static inline margelo::nitro::nitroperf::StutterEpisodes fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::StutterEpisodes(
+        JSIConverter<std::vector<margelo::nitro::nitroperf::StutterEpisode>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "episodes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"))),
+        JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::StutterEpisodes& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "episodes"), JSIConverter<std::vector<margelo::nitro::nitroperf::StutterEpisode>>::toJSI(runtime, arg.episodes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "uiMissed"), JSIConverter<double>::toJSI(runtime, arg.uiMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "jsMissed"), JSIConverter<double>::toJSI(runtime, arg.jsMissed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cursor"), JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::toJSI(runtime, arg.cursor));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::vector<margelo::nitro::nitroperf::StutterEpisode>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "episodes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "uiMissed")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "jsMissed")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroperf::HistoryCursor>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,93 @@
+///
+/// ThreadCpuUsage.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `ThreadCpuStats` to properly resolve imports.
+namespace margelo::nitro::nitroperf { struct ThreadCpuStats; }
+
+#include "ThreadCpuStats.hpp"
+#include <vector>
+
+namespace margelo::nitro::nitroperf {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ThreadCpuUsage).
+   */
+  struct ThreadCpuUsage final {
+  public:
+    double intervalMs     SWIFT_PRIVATE;
+    double processCpuPercent     SWIFT_PRIVATE;
+    std::vector<ThreadCpuStats> threads     SWIFT_PRIVATE;
+
+  public:
+    ThreadCpuUsage() = default;
+    explicit ThreadCpuUsage(double intervalMs, double processCpuPercent, std::vector<ThreadCpuStats> threads): intervalMs(intervalMs), processCpuPercent(processCpuPercent), threads(threads) {}
+
+  public:
+    friend bool operator==(const ThreadCpuUsage& lhs, const ThreadCpuUsage& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroperf
+
+namespace margelo::nitro {
+
+  // C++ ThreadCpuUsage <> JS ThreadCpuUsage (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroperf::ThreadCpuUsage> final {
+    static inline margelo::nitro::nitroperf::ThreadCpuUsage fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroperf::ThreadCpuUsage(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "intervalMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent"))),
+        JSIConverter<std::vector<margelo::nitro::nitroperf::ThreadCpuStats>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "threads")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroperf::ThreadCpuUsage& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "intervalMs"), JSIConverter<double>::toJSI(runtime, arg.intervalMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent"), JSIConverter<double>::toJSI(runtime, arg.processCpuPercent));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "threads"), JSIConverter<std::vector<margelo::nitro::nitroperf::ThreadCpuStats>>::toJSI(runtime, arg.threads));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "intervalMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "processCpuPercent")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroperf::ThreadCpuStats>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "threads")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
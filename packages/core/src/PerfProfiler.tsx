@@ -1,5 +1,4 @@
 import React from 'react'
-import { getPerfMonitor } from './singleton'
 import { recordRender } from './renderStore'
 
 interface PerfProfilerProps {
@@ -15,11 +14,9 @@ export function PerfProfiler({ id = 'PerfProfiler', children }: PerfProfilerProp
       actualDuration: number
     ) => {
       try {
+        // One native call per commit: feeds both the render distribution
+        // and the per-component stats
         recordRender(id, phase, actualDuration)
-        const monitor = getPerfMonitor()
-        if (typeof (monitor as any).reportRender === 'function') {
-          monitor.reportRender(actualDuration)
-        }
       } catch (_e) {
         // Monitor may not be initialized or method unavailable
       }
@@ -0,0 +1,87 @@
+import type { DurationDistribution } from './specs/nitro-perf.nitro'
+
+/**
+ * Number of recorded durations at or above `thresholdMs`, e.g. renders
+ * over a 16 ms budget. Exact to bucket resolution (~3%); a threshold
+ * inside a bucket counts that bucket's values proportionally.
+ */
+export function countOver(distribution: DurationDistribution, thresholdMs: number): number {
+  const { bucketStartsMs, bucketWidthsMs, bucketCounts } = distribution
+  let total = 0
+  for (let i = 0; i < bucketCounts.length; i++) {
+    const start = bucketStartsMs[i]!
+    const end = start + bucketWidthsMs[i]!
+    if (start >= thresholdMs) {
+      total += bucketCounts[i]!
+    } else if (end > thresholdMs) {
+      total += (bucketCounts[i]! * (end - thresholdMs)) / (end - start)
+    }
+  }
+  return Math.round(total)
+}
+
+function percentile(
+  starts: number[],
+  widths: number[],
+  counts: number[],
+  count: number,
+  maxMs: number,
+  q: number
+): number {
+  if (count === 0) return 0
+  const rank = Math.max(1, Math.ceil(q * count))
+  let cumulative = 0
+  for (let i = 0; i < counts.length; i++) {
+    cumulative += counts[i]!
+    if (cumulative >= rank) {
+      // Same rule as native: bucket midpoint, capped at the observed max.
+      // Widths are in ms, and native buckets are 1 µs wide at the bottom.
+      return Math.min(starts[i]! + (widths[i]! - 0.001) / 2, maxMs)
+    }
+  }
+  return maxMs
+}
+
+/**
+ * Combine two distributions (e.g. two sessions, or consecutive
+ * `interval` readings) as if their durations had been recorded into one
+ * histogram.
+ */
+export function mergeDistributions(
+  a: DurationDistribution,
+  b: DurationDistribution
+): DurationDistribution {
+  const buckets = new Map<number, { width: number; count: number }>()
+  for (const d of [a, b]) {
+    d.bucketStartsMs.forEach((start, i) => {
+      const bucket = buckets.get(start)
+      if (bucket) {
+        bucket.count += d.bucketCounts[i]!
+      } else {
+        buckets.set(start, { width: d.bucketWidthsMs[i]!, count: d.bucketCounts[i]! })
+      }
+    })
+  }
+
+  const bucketStartsMs = [...buckets.keys()].sort((x, y) => x - y)
+  const bucketWidthsMs = bucketStartsMs.map((start) => buckets.get(start)!.width)
+  const bucketCounts = bucketStartsMs.map((start) => buckets.get(start)!.count)
+  const count = a.count + b.count
+  const sumMs = a.sumMs + b.sumMs
+  const maxMs = Math.max(a.maxMs, b.maxMs)
+  const p = (q: number) => percentile(bucketStartsMs, bucketWidthsMs, bucketCounts, count, maxMs, q)
+
+  return {
+    count,
+    sumMs,
+    meanMs: count > 0 ? sumMs / count : 0,
+    p50Ms: p(0.5),
+    p90Ms: p(0.9),
+    p95Ms: p(0.95),
+    p99Ms: p(0.99),
+    maxMs,
+    bucketStartsMs,
+    bucketWidthsMs,
+    bucketCounts,
+  }
+}
@@ -0,0 +1,90 @@
+import type { FPSHistory, FPSHistoryDelta } from './specs/nitro-perf.nitro'
+import { getPerfMonitor } from './singleton'
+
+/**
+ * FPS history as typed-array views over native memory. The buffers are
+ * immutable once handed out — treat the arrays as read-only.
+ */
+export interface FPSHistoryView {
+  uiFpsSamples: Int32Array
+  jsFpsSamples: Int32Array
+  uiFpsMin: number
+  uiFpsMax: number
+  jsFpsMin: number
+  jsFpsMax: number
+  /** Changes whenever either sample series changes */
+  generation: number
+}
+
+let cachedView: FPSHistoryView | null = null
+
+/**
+ * Get the FPS history without per-element conversion.
+ *
+ * Checks `historyGeneration` first and returns the previous view when
+ * nothing changed, so polling this is one property read while idle.
+ */
+export function getFpsHistoryView(): FPSHistoryView {
+  const monitor = getPerfMonitor()
+  if (cachedView && cachedView.generation === monitor.historyGeneration) {
+    return cachedView
+  }
+  const buffer = monitor.getHistoryBuffer()
+  cachedView = {
+    uiFpsSamples: new Int32Array(buffer.uiFpsSamples),
+    jsFpsSamples: new Int32Array(buffer.jsFpsSamples),
+    uiFpsMin: buffer.uiFpsMin,
+    uiFpsMax: buffer.uiFpsMax,
+    jsFpsMin: buffer.jsFpsMin,
+    jsFpsMax: buffer.jsFpsMax,
+    generation: buffer.generation,
+  }
+  return cachedView
+}
+
+/** Convert a view to the plain-array `FPSHistory` shape (copies in JS). */
+export function toFPSHistory(view: FPSHistoryView): FPSHistory {
+  return {
+    uiFpsSamples: Array.from(view.uiFpsSamples),
+    jsFpsSamples: Array.from(view.jsFpsSamples),
+    uiFpsMin: view.uiFpsMin,
+    uiFpsMax: view.uiFpsMax,
+    jsFpsMin: view.jsFpsMin,
+    jsFpsMax: view.jsFpsMax,
+  }
+}
+
+/**
+ * Merge an incremental `getHistorySince()` result into a plain history,
+ * keeping at most `maxSamples` per series. A reset discards the previous
+ * samples; gaps (`*Missed`) are simply skipped.
+ */
+export function applyHistoryDelta(
+  history: FPSHistory | null,
+  delta: FPSHistoryDelta,
+  maxSamples: number
+): FPSHistory {
+  const merge = (previous: number[] | undefined, added: number[], reset: boolean) => {
+    const base = reset || !previous ? [] : previous
+    const merged = added.length > 0 ? base.concat(added) : base
+    return merged.length > maxSamples ? merged.slice(merged.length - maxSamples) : merged
+  }
+  return {
+    uiFpsSamples: merge(history?.uiFpsSamples, delta.uiFpsSamples, delta.uiReset),
+    jsFpsSamples: merge(history?.jsFpsSamples, delta.jsFpsSamples, delta.jsReset),
+    uiFpsMin: delta.uiFpsMin,
+    uiFpsMax: delta.uiFpsMax,
+    jsFpsMin: delta.jsFpsMin,
+    jsFpsMax: delta.jsFpsMax,
+  }
+}
+
+/** True when a delta carries no new samples and no reset. */
+export function isEmptyHistoryDelta(delta: FPSHistoryDelta): boolean {
+  return (
+    delta.uiFpsSamples.length === 0 &&
+    delta.jsFpsSamples.length === 0 &&
+    !delta.uiReset &&
+    !delta.jsReset
+  )
+}
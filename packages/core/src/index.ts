@@ -2,6 +2,25 @@
 export type {
   PerfSnapshot,
   FPSHistory,
+  FPSHistoryBuffer,
+  FPSHistoryDelta,
+  HistoryCursor,
+  RawFrameTimestamps,
+  StutterEpisode,
+  StutterEpisodes,
+  JankEvent,
+  ClockMapping,
+  MetricRollups,
+  RollupStats,
+  SnapshotSeries,
+  FrameTimeStats,
+  FrameTimePercentiles,
+  DurationDistribution,
+  DistributionSet,
+  Distributions,
+  ComponentRenderStats,
+  ThreadCpuStats,
+  ThreadCpuUsage,
   PerfConfig,
   PerfMonitor,
 } from './specs/nitro-perf.nitro'
@@ -18,6 +37,24 @@ export type {
 export { usePerfMetrics } from './usePerfMetrics'
 export { PerfOverlay } from './PerfOverlay'
 export { getPerfMonitor, startJsFrameLoop, stopJsFrameLoop } from './singleton'
+export {
+  PERF_SNAPSHOT_FIELDS,
+  getSnapshotFieldMask,
+  subscribePerfFields,
+  subscribePerfChanges,
+} from './snapshotFields'
+export type { PerfSnapshotField, PerfChangeOptions } from './snapshotFields'
+export {
+  getFpsHistoryView,
+  toFPSHistory,
+  applyHistoryDelta,
+  isEmptyHistoryDelta,
+} from './historyView'
+export type { FPSHistoryView } from './historyView'
+export { getSnapshotColumns, toSnapshotRows } from './snapshotRange'
+export { setRawFrameCapture, holdRawFrameCapture, decodeFrameTimestamps } from './rawFrames'
+export { countOver, mergeDistributions } from './distributions'
+export type { SnapshotColumns, SnapshotRangeOptions } from './snapshotRange'
 export {
   registerDevMenuItem,
   setPerfOverlayVisible,
@@ -27,4 +64,3 @@ export { PerfProfiler } from './PerfProfiler'
 export { getArchInfo } from './archDetection'
 export { getStartupTiming } from './startupTiming'
 export { getComponentRenderStats, resetComponentRenderStats } from './renderStore'
-export type { ComponentRenderStats } from './renderStore'
@@ -0,0 +1,53 @@
+import { getPerfMonitor } from './singleton'
+
+// The native rings are sized to the largest of the app's capacity and
+// every outstanding hold, so tools can't switch off the app's capture
+let appCapacity = 0
+const holds = new Map<number, number>()
+let nextHoldId = 1
+
+function applyRawFrameCapture(): void {
+  let capacity = appCapacity
+  for (const held of holds.values()) {
+    capacity = Math.max(capacity, held)
+  }
+  getPerfMonitor().setRawFrameCapture(capacity)
+}
+
+/**
+ * Start keeping the timestamp of every UI and JS frame (the newest
+ * `capacity` per thread, at most 65536). Pass 0 to stop and free the
+ * rings. Read with `getPerfMonitor().getRawFramesSince(cursor)`.
+ */
+export function setRawFrameCapture(capacity: number): void {
+  appCapacity = capacity > 0 ? capacity : 0
+  applyRawFrameCapture()
+}
+
+/**
+ * Keep at least `capacity` raw frames per thread until the returned
+ * release function is called, without overriding setRawFrameCapture().
+ * For tools that attach and detach, like the DevTools panel.
+ */
+export function holdRawFrameCapture(capacity: number): () => void {
+  const id = nextHoldId++
+  holds.set(id, capacity > 0 ? capacity : 0)
+  applyRawFrameCapture()
+  return () => {
+    if (holds.delete(id)) applyRawFrameCapture()
+  }
+}
+
+/**
+ * Decode a raw frame buffer (little-endian int64 nanoseconds) to
+ * milliseconds. Avoids BigInt, so it's exact for timestamps below 2^53 ns
+ * (~104 days of uptime).
+ */
+export function decodeFrameTimestamps(buffer: ArrayBuffer): Float64Array {
+  const words = new Uint32Array(buffer)
+  const ms = new Float64Array(words.length / 2)
+  for (let i = 0; i < ms.length; i++) {
+    ms[i] = (words[2 * i + 1]! * 2 ** 32 + words[2 * i]!) / 1e6
+  }
+  return ms
+}
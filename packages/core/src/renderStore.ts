@@ -1,67 +1,44 @@
-export interface ComponentRenderStats {
-  componentId: string
-  renderCount: number
-  totalDurationMs: number
-  avgDurationMs: number
-  maxDurationMs: number
-  lastDurationMs: number
-  mountCount: number
-  updateCount: number
-  nestedUpdateCount: number
-}
+import type { ComponentRenderStats } from './specs/nitro-perf.nitro'
+import { getPerfMonitor } from './singleton'
+
+export type { ComponentRenderStats }
+
+/** Components returned by getComponentRenderStats() by default */
+const DEFAULT_TOP_K = 50
 
-const MAX_ENTRIES = 50
+const PHASES = { mount: 0, update: 1, 'nested-update': 2 } as const
 
-const store = new Map<string, ComponentRenderStats>()
+// Native ids per Profiler id, so each commit crosses JSI with numbers only
+const componentIds = new Map<string, number>()
 
+/**
+ * Record one React commit. Aggregation (per-component counters and the
+ * top-K of hottest components) happens natively.
+ */
 export function recordRender(
   id: string,
   phase: 'mount' | 'update' | 'nested-update',
   durationMs: number
 ): void {
-  const existing = store.get(id)
-
-  if (existing) {
-    existing.renderCount++
-    existing.totalDurationMs += durationMs
-    existing.avgDurationMs = existing.totalDurationMs / existing.renderCount
-    existing.maxDurationMs = Math.max(existing.maxDurationMs, durationMs)
-    existing.lastDurationMs = durationMs
-    if (phase === 'mount') existing.mountCount++
-    else if (phase === 'update') existing.updateCount++
-    else if (phase === 'nested-update') existing.nestedUpdateCount++
-  } else {
-    // Evict lowest-renderCount entry if at capacity
-    if (store.size >= MAX_ENTRIES) {
-      let minKey: string | null = null
-      let minCount = Infinity
-      for (const [key, stats] of store) {
-        if (stats.renderCount < minCount) {
-          minCount = stats.renderCount
-          minKey = key
-        }
-      }
-      if (minKey) store.delete(minKey)
-    }
-
-    store.set(id, {
-      componentId: id,
-      renderCount: 1,
-      totalDurationMs: durationMs,
-      avgDurationMs: durationMs,
-      maxDurationMs: durationMs,
-      lastDurationMs: durationMs,
-      mountCount: phase === 'mount' ? 1 : 0,
-      updateCount: phase === 'update' ? 1 : 0,
-      nestedUpdateCount: phase === 'nested-update' ? 1 : 0,
-    })
+  const monitor = getPerfMonitor()
+  let componentId = componentIds.get(id)
+  if (componentId === undefined) {
+    componentId = monitor.registerComponent(id)
+    componentIds.set(id, componentId)
   }
+  monitor.reportComponentRender(componentId, PHASES[phase], durationMs)
 }
 
-export function getComponentRenderStats(): ComponentRenderStats[] {
-  return Array.from(store.values()).sort((a, b) => b.renderCount - a.renderCount)
+/**
+ * The most-rendered components, most renders first. Tracked with the
+ * Space-Saving algorithm, so `renderCount` may overestimate by up to
+ * `countError` for components that entered the top-K late. Pass
+ * `maxCount <= 0` for every tracked component.
+ */
+export function getComponentRenderStats(maxCount: number = DEFAULT_TOP_K): ComponentRenderStats[] {
+  return getPerfMonitor().getComponentRenderStats(maxCount)
 }
 
 export function resetComponentRenderStats(): void {
-  store.clear()
+  getPerfMonitor().resetComponentRenderStats()
 }
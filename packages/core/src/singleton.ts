@@ -5,6 +5,49 @@ import { startObservers, stopObservers } from './observers'
 let perfMonitorInstance: PerfMonitor | null = null
 let jsFrameRafId: number | null = null
 
+// rAF timestamps are buffered and handed to native in one JSI call per
+// batch, so measuring JS FPS doesn't cost a native call every frame.
+// Flushed when full or once the oldest entry is JS_FRAME_BATCH_MAX_AGE_MS
+// old, which bounds how stale the native JS FPS can get. Only on-budget
+// frames wait: a frame longer than JS_FRAME_FLUSH_PERIODS frame periods
+// is flushed at once, so native pushes jank and closes stutter episodes
+// right after it ends. Native counts a skipped vsync from 1.5 periods.
+const JS_FRAME_BATCH_SIZE = 16
+const JS_FRAME_BATCH_MAX_AGE_MS = 250
+const JS_FRAME_FLUSH_PERIODS = 1.25
+const jsFrameBatch = new Float64Array(JS_FRAME_BATCH_SIZE)
+const jsFrameIntervals = new Float64Array(JS_FRAME_BATCH_SIZE - 1)
+let jsFrameBatchCount = 0
+let lastJsFrameMs = 0
+// Median interval of the last full batch; a median, so a few long frames
+// don't move it and a 120 Hz device briefly at 60 Hz doesn't halve it
+let jsFramePeriodMs = 1000 / 60
+
+function updateJsFramePeriod(): void {
+  for (let i = 1; i < JS_FRAME_BATCH_SIZE; i++) {
+    jsFrameIntervals[i - 1] = jsFrameBatch[i]! - jsFrameBatch[i - 1]!
+  }
+  jsFrameIntervals.sort()
+  jsFramePeriodMs = jsFrameIntervals[jsFrameIntervals.length >> 1]!
+}
+
+function flushJsFrameBatch(monitor: PerfMonitor): void {
+  if (jsFrameBatchCount === 0) return
+  monitor.reportJsFrameTicks(jsFrameBatch.buffer, jsFrameBatchCount)
+  jsFrameBatchCount = 0
+}
+
+// Each call measures performance.now() against the native monotonic clock
+// and native keeps the tightest reading; a few back-to-back calls make a
+// fast one likely.
+const CLOCK_CALIBRATION_ROUNDS = 3
+
+function calibrateJsClock(monitor: PerfMonitor): void {
+  for (let i = 0; i < CLOCK_CALIBRATION_ROUNDS; i++) {
+    monitor.calibrateJsClock(performance.now())
+  }
+}
+
 /**
  * Get the singleton PerfMonitor HybridObject.
  * Creates the native Nitro module on first call.
@@ -12,6 +55,7 @@ let jsFrameRafId: number | null = null
 export function getPerfMonitor(): PerfMonitor {
   if (!perfMonitorInstance) {
     perfMonitorInstance = NitroModules.createHybridObject<PerfMonitor>('PerfMonitor')
+    calibrateJsClock(perfMonitorInstance)
   }
   return perfMonitorInstance
 }
@@ -23,9 +67,22 @@ export function getPerfMonitor(): PerfMonitor {
 export function startJsFrameLoop(): void {
   if (jsFrameRafId !== null) return // already running
   const monitor = getPerfMonitor()
+  calibrateJsClock(monitor)
   const tick = () => {
     if (jsFrameRafId !== null) {
-      monitor.reportJsFrameTick(performance.now())
+      const now = performance.now()
+      const intervalMs = lastJsFrameMs > 0 ? now - lastJsFrameMs : 0
+      lastJsFrameMs = now
+      jsFrameBatch[jsFrameBatchCount++] = now
+      if (jsFrameBatchCount === JS_FRAME_BATCH_SIZE) {
+        updateJsFramePeriod()
+        flushJsFrameBatch(monitor)
+      } else if (
+        intervalMs > jsFramePeriodMs * JS_FRAME_FLUSH_PERIODS ||
+        now - jsFrameBatch[0]! >= JS_FRAME_BATCH_MAX_AGE_MS
+      ) {
+        flushJsFrameBatch(monitor)
+      }
       jsFrameRafId = requestAnimationFrame(tick)
     }
   }
@@ -41,5 +98,7 @@ export function stopJsFrameLoop(): void {
     cancelAnimationFrame(jsFrameRafId)
     jsFrameRafId = null
   }
+  flushJsFrameBatch(getPerfMonitor())
+  lastJsFrameMs = 0
   stopObservers()
 }
@@ -0,0 +1,131 @@
+import type { PerfSnapshot } from './specs/nitro-perf.nitro'
+import { getPerfMonitor } from './singleton'
+
+/**
+ * PerfSnapshot fields in native order. Bit i of a `subscribeFields()` mask
+ * selects field i. Must match kSnapshotFields in cpp/HybridPerfMonitor.cpp.
+ */
+export const PERF_SNAPSHOT_FIELDS = [
+  'uiFps',
+  'jsFps',
+  'ramBytes',
+  'jsHeapUsedBytes',
+  'jsHeapTotalBytes',
+  'droppedFrames',
+  'stutterCount',
+  'timestamp',
+  'longTaskCount',
+  'longTaskTotalMs',
+  'slowEventCount',
+  'maxEventDurationMs',
+  'renderCount',
+  'lastRenderDurationMs',
+  'refreshRateHz',
+  'schedulerLatenessMs',
+  'pssBytes',
+  'privateCleanBytes',
+  'privateDirtyBytes',
+  'swapBytes',
+  'anonBytes',
+  'fileBytes',
+  'processCpuPercent',
+  'uiCpuPercent',
+  'jsCpuPercent',
+  'uiRunQueueMsPerSec',
+  'jsRunQueueMsPerSec',
+  'uiPreemptionsPerSec',
+  'jsPreemptionsPerSec',
+  'uiVoluntarySwitchesPerSec',
+  'jsVoluntarySwitchesPerSec',
+  'minorFaultsPerSec',
+  'majorFaultsPerSec',
+] as const satisfies readonly (keyof PerfSnapshot)[]
+
+export type PerfSnapshotField = (typeof PERF_SNAPSHOT_FIELDS)[number]
+
+/**
+ * Build a `subscribeFields()` mask. Uses arithmetic rather than bitwise
+ * ops so masks aren't limited to 32 fields.
+ */
+export function getSnapshotFieldMask(fields: readonly PerfSnapshotField[]): number {
+  let mask = 0
+  PERF_SNAPSHOT_FIELDS.forEach((field, i) => {
+    if (fields.includes(field)) mask += 2 ** i
+  })
+  return mask
+}
+
+/**
+ * Subscribe to a subset of PerfSnapshot fields at its own cadence.
+ *
+ * Native sends only the requested values as a flat number array, so each
+ * delivery costs one small array instead of a full snapshot object.
+ * `intervalMs` of 0 follows the global `updateIntervalMs`.
+ * Returns a subscription id for `unsubscribe()`.
+ */
+export function subscribePerfFields<K extends PerfSnapshotField>(
+  fields: readonly K[],
+  intervalMs: number,
+  cb: (metrics: Pick<PerfSnapshot, K>) => void
+): number {
+  const ordered = PERF_SNAPSHOT_FIELDS.filter((field) =>
+    (fields as readonly PerfSnapshotField[]).includes(field)
+  ) as unknown as K[]
+  return getPerfMonitor().subscribeFields(
+    getSnapshotFieldMask(ordered),
+    intervalMs,
+    (values) => {
+      const metrics = {} as Pick<PerfSnapshot, K>
+      for (let i = 0; i < ordered.length; i++) {
+        metrics[ordered[i]!] = values[i] as Pick<PerfSnapshot, K>[K]
+      }
+      cb(metrics)
+    }
+  )
+}
+
+export interface PerfChangeOptions<K extends PerfSnapshotField> {
+  /** Check interval. 0 follows the global `updateIntervalMs`. Default: 0 */
+  intervalMs?: number
+  /** Deliver a timestamp-only update after this long without changes; 0 disables. Default: 5000 */
+  heartbeatMs?: number
+  /** Per-field change thresholds overriding the native defaults */
+  epsilons?: Partial<Record<K, number>>
+}
+
+/**
+ * Subscribe to changes of a subset of PerfSnapshot fields.
+ *
+ * Native compares each field against the value it last delivered and
+ * skips ticks where nothing moved beyond its epsilon, so an idle app
+ * doesn't wake JS at all. Deliveries carry only the changed fields (plus
+ * `timestamp` when requested); a heartbeat proves liveness while idle.
+ * The first delivery contains every requested field.
+ */
+export function subscribePerfChanges<K extends PerfSnapshotField>(
+  fields: readonly K[],
+  options: PerfChangeOptions<K>,
+  cb: (changes: Partial<Pick<PerfSnapshot, K>>) => void
+): number {
+  const { intervalMs = 0, heartbeatMs = 5000, epsilons = {} } = options
+  const thresholds = PERF_SNAPSHOT_FIELDS.map(
+    (field) => (epsilons as Partial<Record<PerfSnapshotField, number>>)[field] ?? -1
+  )
+  return getPerfMonitor().subscribeChanges(
+    getSnapshotFieldMask(fields),
+    intervalMs,
+    heartbeatMs,
+    thresholds,
+    (changedMask, values) => {
+      const changes: Partial<Pick<PerfSnapshot, K>> = {}
+      let next = 0
+      for (let i = 0; i < PERF_SNAPSHOT_FIELDS.length && next < values.length; i++) {
+        if (Math.floor(changedMask / 2 ** i) % 2 === 1) {
+          const field = PERF_SNAPSHOT_FIELDS[i] as K
+          changes[field] = values[next++] as Pick<PerfSnapshot, K>[K]
+        }
+      }
+      cb(changes)
+    }
+  )
+}
@@ -0,0 +1,67 @@
+import type { PerfSnapshot } from './specs/nitro-perf.nitro'
+import { getPerfMonitor } from './singleton'
+import { PERF_SNAPSHOT_FIELDS, getSnapshotFieldMask } from './snapshotFields'
+import type { PerfSnapshotField } from './snapshotFields'
+
+type StoredField = Exclude<PerfSnapshotField, 'timestamp'>
+
+/** Stored snapshots as one typed array per field, oldest row first. */
+export interface SnapshotColumns<K extends StoredField = StoredField> {
+  rows: number
+  timestamps: Float64Array
+  columns: Record<K, Float64Array>
+}
+
+export interface SnapshotRangeOptions<K extends StoredField> {
+  /** Only rows at or after this timestamp (ms). Default: 0 (oldest) */
+  fromMs?: number
+  /** Only rows at or before this timestamp (ms); 0 means now. Default: 0 */
+  toMs?: number
+  /** Fields to return. Default: all */
+  fields?: readonly K[]
+  /** Keep only the newest N rows; 0 means all. Default: 0 */
+  maxRows?: number
+}
+
+/**
+ * Read snapshots retained natively (one row per global update interval,
+ * ~30 min at the default 500 ms). The columns are views over a single
+ * copy of native memory, so reading a whole session costs two buffers.
+ */
+export function getSnapshotColumns<K extends StoredField = StoredField>(
+  options: SnapshotRangeOptions<K> = {}
+): SnapshotColumns<K> {
+  const { fromMs = 0, toMs = 0, fields, maxRows = 0 } = options
+  const series = getPerfMonitor().getSnapshotRange(
+    fromMs,
+    toMs,
+    fields ? getSnapshotFieldMask(fields) : 0,
+    maxRows
+  )
+  const values = new Float64Array(series.values)
+  const columns = {} as Record<K, Float64Array>
+  let offset = 0
+  PERF_SNAPSHOT_FIELDS.forEach((field, i) => {
+    if (Math.floor(series.fieldMask / 2 ** i) % 2 === 1) {
+      columns[field as K] = values.subarray(offset, offset + series.rows)
+      offset += series.rows
+    }
+  })
+  return { rows: series.rows, timestamps: new Float64Array(series.timestamps), columns }
+}
+
+/** Convert columns to one object per row (allocates; use for export). */
+export function toSnapshotRows<K extends StoredField>(
+  data: SnapshotColumns<K>
+): (Pick<PerfSnapshot, K> & { timestamp: number })[] {
+  const fields = Object.keys(data.columns) as K[]
+  const rows: (Pick<PerfSnapshot, K> & { timestamp: number })[] = []
+  for (let r = 0; r < data.rows; r++) {
+    const row = { timestamp: data.timestamps[r]! } as Pick<PerfSnapshot, K> & { timestamp: number }
+    for (const field of fields) {
+      row[field] = data.columns[field][r] as (Pick<PerfSnapshot, K> & { timestamp: number })[K]
+    }
+    rows.push(row)
+  }
+  return rows
+}
@@ -15,6 +15,25 @@ export interface PerfSnapshot {
   maxEventDurationMs: number
   renderCount: number
   lastRenderDurationMs: number
+  refreshRateHz: number
+  schedulerLatenessMs: number
+  pssBytes: number
+  privateCleanBytes: number
+  privateDirtyBytes: number
+  swapBytes: number
+  anonBytes: number
+  fileBytes: number
+  processCpuPercent: number
+  uiCpuPercent: number
+  jsCpuPercent: number
+  uiRunQueueMsPerSec: number
+  jsRunQueueMsPerSec: number
+  uiPreemptionsPerSec: number
+  jsPreemptionsPerSec: number
+  uiVoluntarySwitchesPerSec: number
+  jsVoluntarySwitchesPerSec: number
+  minorFaultsPerSec: number
+  majorFaultsPerSec: number
 }
 
 export interface FPSHistory {
@@ -26,10 +45,182 @@ export interface FPSHistory {
   jsFpsMax: number
 }
 
+export interface FPSHistoryBuffer {
+  uiFpsSamples: ArrayBuffer
+  jsFpsSamples: ArrayBuffer
+  uiFpsMin: number
+  uiFpsMax: number
+  jsFpsMin: number
+  jsFpsMax: number
+  generation: number
+}
+
+export interface HistoryCursor {
+  ui: number
+  js: number
+}
+
+export interface FPSHistoryDelta {
+  uiFpsSamples: number[]
+  jsFpsSamples: number[]
+  uiMissed: number
+  jsMissed: number
+  uiReset: boolean
+  jsReset: boolean
+  cursor: HistoryCursor
+  uiFpsMin: number
+  uiFpsMax: number
+  jsFpsMin: number
+  jsFpsMax: number
+}
+
+export interface RawFrameTimestamps {
+  uiTimestampsNs: ArrayBuffer
+  jsTimestampsNs: ArrayBuffer
+  uiMissed: number
+  jsMissed: number
+  cursor: HistoryCursor
+}
+
+export interface StutterEpisode {
+  thread: string
+  startMs: number
+  endMs: number
+  durationMs: number
+  framesSkipped: number
+  worstFrameMs: number
+  slowFrames: number
+  runningMs: number
+  runQueueMs: number
+  minorFaults: number
+  majorFaults: number
+}
+
+export interface StutterEpisodes {
+  episodes: StutterEpisode[]
+  uiMissed: number
+  jsMissed: number
+  cursor: HistoryCursor
+}
+
+export interface JankEvent {
+  thread: string
+  frameEndMs: number
+  frameMs: number
+  framesSkipped: number
+  episodeStart: boolean
+  overThreshold: boolean
+  latencyMs: number
+  coalesced: number
+}
+
+export interface ClockMapping {
+  monotonicNowNs: number
+  wallClockOffsetMs: number
+  jsClockOffsetMs: number
+  jsCalibrated: boolean
+}
+
+export interface RollupStats {
+  min: number[]
+  max: number[]
+  mean: number[]
+}
+
+export interface MetricRollups {
+  resolutionMs: number
+  timestamps: number[]
+  counts: number[]
+  uiFps: RollupStats
+  jsFps: RollupStats
+  ramBytes: RollupStats
+  jsHeapUsedBytes: RollupStats
+  droppedFrames: RollupStats
+}
+
+export interface SnapshotSeries {
+  fieldMask: number
+  rows: number
+  timestamps: ArrayBuffer
+  values: ArrayBuffer
+}
+
+export interface FrameTimeStats {
+  frameCount: number
+  meanMs: number
+  p50Ms: number
+  p90Ms: number
+  p99Ms: number
+  p999Ms: number
+  maxMs: number
+}
+
+export interface DurationDistribution {
+  count: number
+  sumMs: number
+  meanMs: number
+  p50Ms: number
+  p90Ms: number
+  p95Ms: number
+  p99Ms: number
+  maxMs: number
+  bucketStartsMs: number[]
+  bucketWidthsMs: number[]
+  bucketCounts: number[]
+}
+
+export interface DistributionSet {
+  longTasks: DurationDistribution
+  slowEvents: DurationDistribution
+  renders: DurationDistribution
+}
+
+export interface Distributions {
+  total: DistributionSet
+  interval: DistributionSet
+  intervalMs: number
+}
+
+export interface ComponentRenderStats {
+  componentId: string
+  renderCount: number
+  countError: number
+  totalDurationMs: number
+  avgDurationMs: number
+  maxDurationMs: number
+  lastDurationMs: number
+  mountCount: number
+  updateCount: number
+  nestedUpdateCount: number
+}
+
+export interface FrameTimePercentiles {
+  ui: FrameTimeStats
+  js: FrameTimeStats
+}
+
+export interface ThreadCpuStats {
+  tid: number
+  name: string
+  role: string
+  state: string
+  lastCpu: number
+  cpuPercent: number
+}
+
+export interface ThreadCpuUsage {
+  intervalMs: number
+  processCpuPercent: number
+  threads: ThreadCpuStats[]
+}
+
 export interface PerfConfig {
   updateIntervalMs: number
   maxHistorySamples: number
   targetFps: number
+  stutterMergeGapMs?: number
+  jankThresholdMs?: number
+  memoryBreakdownIntervalMs?: number
 }
 
 export interface PerfMonitor
@@ -37,14 +228,36 @@ export interface PerfMonitor
   start(): void
   stop(): void
   readonly isRunning: boolean
+  readonly historyGeneration: number
   getMetrics(): PerfSnapshot
   getHistory(): FPSHistory
-  subscribe(cb: (m: PerfSnapshot) => void): number
+  getHistoryBuffer(): FPSHistoryBuffer
+  getHistorySince(cursor: HistoryCursor): FPSHistoryDelta
+  getRollups(fromMs: number, toMs: number, maxPoints: number): MetricRollups
+  getSnapshotRange(fromMs: number, toMs: number, fieldMask: number, maxRows: number): SnapshotSeries
+  getFrameTimePercentiles(): FrameTimePercentiles
+  getDistributions(): Distributions
+  getThreadCpuUsage(): ThreadCpuUsage
+  setRawFrameCapture(capacity: number): void
+  getRawFramesSince(cursor: HistoryCursor): RawFrameTimestamps
+  getStutterEpisodesSince(cursor: HistoryCursor): StutterEpisodes
+  subscribe(cb: (m: PerfSnapshot) => void, intervalMs?: number): number
+  subscribeFields(fieldMask: number, intervalMs: number, cb: (values: number[]) => void): number
+  subscribeChanges(fieldMask: number, intervalMs: number, heartbeatMs: number, epsilons: number[], cb: (changedMask: number, values: number[]) => void): number
+  subscribeStutters(cb: (episodes: StutterEpisode[]) => void): number
+  subscribeJank(cb: (event: JankEvent) => void): number
   unsubscribe(id: number): void
   reportJsFrameTick(ts: number): void
+  reportJsFrameTicks(timestamps: ArrayBuffer, count: number): void
+  calibrateJsClock(performanceNowMs: number): void
+  getClockMapping(): ClockMapping
   reportLongTask(durationMs: number): void
   reportSlowEvent(durationMs: number): void
   reportRender(actualDurationMs: number): void
+  registerComponent(name: string): number
+  reportComponentRender(componentId: number, phase: number, actualDurationMs: number): void
+  getComponentRenderStats(maxCount: number): ComponentRenderStats[]
+  resetComponentRenderStats(): void
   reportJsHeap(usedBytes: number, totalBytes: number): void
   configure(config: PerfConfig): void
   reset(): void
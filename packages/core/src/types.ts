@@ -1,6 +1,13 @@
 import type { PerfSnapshot, FPSHistory } from './specs/nitro-perf.nitro'
 
-export type { PerfSnapshot, FPSHistory, PerfConfig, PerfMonitor } from './specs/nitro-perf.nitro'
+export type {
+  PerfSnapshot,
+  FPSHistory,
+  FrameTimeStats,
+  FrameTimePercentiles,
+  PerfConfig,
+  PerfMonitor,
+} from './specs/nitro-perf.nitro'
 export type { ArchInfo } from './archDetection'
 export type { StartupTiming } from './startupTiming'
 
@@ -19,6 +26,11 @@ export interface UsePerfMetricsOptions {
   maxHistorySamples?: number
   /** Target FPS for dropped frame calculation. Default: 60 */
   targetFps?: number
+  /**
+   * Only re-render when a metric actually changes (native delta delivery).
+   * Reduces JS wake-ups and GC pressure while the app is idle. Default: false
+   */
+  changesOnly?: boolean
 }
 
 export interface UsePerfMetricsReturn extends PerfMetricsState {
@@ -1,7 +1,9 @@
 import { useState, useEffect, useCallback, useRef } from 'react'
-import type { PerfSnapshot, FPSHistory, PerfMonitor } from './specs/nitro-perf.nitro'
+import type { PerfSnapshot, FPSHistory, HistoryCursor, PerfMonitor } from './specs/nitro-perf.nitro'
 import type { UsePerfMetricsOptions, UsePerfMetricsReturn } from './types'
 import { getPerfMonitor, startJsFrameLoop, stopJsFrameLoop } from './singleton'
+import { PERF_SNAPSHOT_FIELDS, subscribePerfChanges } from './snapshotFields'
+import { applyHistoryDelta, isEmptyHistoryDelta } from './historyView'
 
 /**
  * React hook that provides real-time performance metrics.
@@ -17,6 +19,7 @@ export function usePerfMetrics(
     updateIntervalMs = 500,
     maxHistorySamples = 60,
     targetFps = 60,
+    changesOnly = false,
   } = options
 
   const [metrics, setMetrics] = useState<PerfSnapshot | null>(null)
@@ -62,15 +65,28 @@ export function usePerfMetrics(
   useEffect(() => {
     const monitor = getMonitor()
 
-    // Subscribe to native metric updates (snapshot only — no getHistory() here)
-    const subId = monitor.subscribe((snapshot: PerfSnapshot) => {
-      setMetrics(snapshot)
-    })
+    // Subscribe to native metric updates (snapshot only — no getHistory() here).
+    // In changes-only mode native skips idle ticks and sends only the fields
+    // that moved; timestamp-only heartbeats don't re-render.
+    const subId = changesOnly
+      ? subscribePerfChanges(PERF_SNAPSHOT_FIELDS, {}, (changes) => {
+          if (Object.keys(changes).every((key) => key === 'timestamp')) return
+          setMetrics((prev) => ({ ...prev, ...changes }) as PerfSnapshot)
+        })
+      : monitor.subscribe((snapshot: PerfSnapshot) => {
+          setMetrics(snapshot)
+        })
 
-    // Poll history on a slower cadence (FPSTracker only produces ~1 sample/sec)
+    // Poll history on a slower cadence (FPSTracker only produces ~1 sample/sec).
+    // Each poll transfers only the samples recorded since the last one.
+    let historyCursor: HistoryCursor = { ui: 0, js: 0 }
     const historyTimer = setInterval(() => {
       if (monitor.isRunning) {
-        setHistory(monitor.getHistory())
+        const delta = monitor.getHistorySince(historyCursor)
+        historyCursor = delta.cursor
+        if (!isEmptyHistoryDelta(delta)) {
+          setHistory((prev) => applyHistoryDelta(prev, delta, maxHistorySamples))
+        }
       }
     }, 2000)
 
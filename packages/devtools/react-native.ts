@@ -1,11 +1,31 @@
 import { useEffect } from 'react'
 import { useRozeniteDevToolsClient } from '@rozenite/plugin-bridge'
-import { getPerfMonitor, getArchInfo, getStartupTiming, getComponentRenderStats } from '@nitro-perf-devtools/core'
-import type { PerfSnapshot, FPSHistory, ArchInfo, StartupTiming, ComponentRenderStats } from '@nitro-perf-devtools/core'
+import {
+  getPerfMonitor,
+  getArchInfo,
+  getStartupTiming,
+  getComponentRenderStats,
+  isEmptyHistoryDelta,
+  getSnapshotColumns,
+  toSnapshotRows,
+  holdRawFrameCapture,
+  decodeFrameTimestamps,
+} from '@nitro-perf-devtools/core'
+import type {
+  PerfSnapshot,
+  FPSHistory,
+  FPSHistoryDelta,
+  HistoryCursor,
+  ArchInfo,
+  StartupTiming,
+  ComponentRenderStats,
+  StutterEpisode,
+} from '@nitro-perf-devtools/core'
 
 interface PerfEvents extends Record<string, unknown> {
   'perf-snapshot': PerfSnapshot
   'perf-history': FPSHistory
+  'perf-history-delta': FPSHistoryDelta
   'request-snapshot': Record<string, never>
   'request-history': Record<string, never>
   'start-monitor': Record<string, never>
@@ -14,6 +34,10 @@ interface PerfEvents extends Record<string, unknown> {
   'export-session': Record<string, never>
   'clear-data': Record<string, never>
   'session-data': { snapshots: PerfSnapshot[]; history: FPSHistory }
+  'request-snapshot-range': { maxRows: number }
+  'snapshot-range': { snapshots: PerfSnapshot[] }
+  'raw-frames': { uiTimestampsMs: number[]; uiMissed: number }
+  'stutter-episodes': StutterEpisode[]
   'request-arch-info': Record<string, never>
   'arch-info': ArchInfo
   'request-startup-timing': Record<string, never>
@@ -84,9 +108,16 @@ export function useNitroPerfDevTools(options: UseNitroPerfDevToolsOptions = {})
       client.send('perf-history', monitor.getHistory())
     })
 
+    // Snapshots retained natively, so a reloaded panel can backfill and an
+    // export covers the whole session rather than the current instant
+    client.onMessage('request-snapshot-range', ({ maxRows }) => {
+      const snapshots = toSnapshotRows(getSnapshotColumns({ maxRows })) as PerfSnapshot[]
+      client.send('snapshot-range', { snapshots })
+    })
+
     client.onMessage('export-session', () => {
       client.send('session-data', {
-        snapshots: [monitor.getMetrics()],
+        snapshots: toSnapshotRows(getSnapshotColumns()) as PerfSnapshot[],
         history: monitor.getHistory(),
       })
     })
@@ -99,18 +130,46 @@ export function useNitroPerfDevTools(options: UseNitroPerfDevToolsOptions = {})
       client.send('startup-timing', getStartupTiming())
     })
 
-    // Push periodic metric updates to the panel
+    // Push metric updates to the panel once a second, independent of the
+    // app's own updateIntervalMs
     const subId = monitor.subscribe((snapshot: PerfSnapshot) => {
       client.send('perf-snapshot', snapshot)
+    }, 1000)
+
+    // Stutter episodes are pushed by native as they close
+    const stutterSubId = monitor.subscribeStutters((episodes: StutterEpisode[]) => {
+      client.send('stutter-episodes', episodes)
     })
 
-    // Also periodically push history
+    // Also periodically push history: only samples recorded since the last
+    // push cross JSI and the websocket
+    let historyCursor: HistoryCursor = { ui: 0, js: 0 }
     const historyInterval = setInterval(() => {
       if (monitor.isRunning) {
-        client.send('perf-history', monitor.getHistory())
+        const delta = monitor.getHistorySince(historyCursor)
+        historyCursor = delta.cursor
+        if (!isEmptyHistoryDelta(delta)) {
+          client.send('perf-history-delta', delta)
+        }
       }
     }, 3000)
 
+    // Capture raw frame timestamps while the panel is attached, so the
+    // frame budget charts show actual frame times (300 frames are drawn).
+    // A hold, so detaching leaves capture the app enabled itself running
+    const releaseRawFrames = holdRawFrameCapture(600)
+    let frameCursor: HistoryCursor = { ui: 0, js: 0 }
+    const rawFramesInterval = setInterval(() => {
+      if (monitor.isRunning) {
+        const frames = monitor.getRawFramesSince(frameCursor)
+        frameCursor = frames.cursor
+        const uiTimestampsMs = Array.from(decodeFrameTimestamps(frames.uiTimestampsNs))
+        if (uiTimestampsMs.length > 0 || frames.uiMissed > 0) {
+          client.send('raw-frames', { uiTimestampsMs, uiMissed: frames.uiMissed })
+        }
+      }
+    }, 1000)
+
     // Periodically push per-component render stats
     const componentStatsInterval = setInterval(() => {
       if (monitor.isRunning) {
@@ -123,7 +182,10 @@ export function useNitroPerfDevTools(options: UseNitroPerfDevToolsOptions = {})
 
     return () => {
       monitor.unsubscribe(subId)
+      monitor.unsubscribe(stutterSubId)
       clearInterval(historyInterval)
+      clearInterval(rawFramesInterval)
+      releaseRawFrames()
       clearInterval(componentStatsInterval)
     }
   }, [client, enableAIInsights])
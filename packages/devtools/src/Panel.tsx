@@ -74,6 +74,13 @@ interface PerfSnapshot {
   maxEventDurationMs: number
   renderCount: number
   lastRenderDurationMs: number
+  refreshRateHz: number
+  pssBytes: number
+  privateCleanBytes: number
+  privateDirtyBytes: number
+  swapBytes: number
+  anonBytes: number
+  fileBytes: number
 }
 
 interface ComponentRenderStats {
@@ -111,9 +118,37 @@ interface FPSHistory {
   jsFpsMax: number
 }
 
+/** Samples recorded since the app's last history push */
+interface FPSHistoryDelta {
+  uiFpsSamples: number[]
+  jsFpsSamples: number[]
+  uiReset: boolean
+  jsReset: boolean
+  uiFpsMin: number
+  uiFpsMax: number
+  jsFpsMin: number
+  jsFpsMax: number
+}
+
+/** A native stutter episode, pushed as it closes */
+interface StutterEpisode {
+  thread: string
+  startMs: number
+  endMs: number
+  durationMs: number
+  framesSkipped: number
+  worstFrameMs: number
+  slowFrames: number
+  runningMs: number
+  runQueueMs: number
+  minorFaults: number
+  majorFaults: number
+}
+
 interface PerfEvents extends Record<string, unknown> {
   'perf-snapshot': PerfSnapshot
   'perf-history': FPSHistory
+  'perf-history-delta': FPSHistoryDelta
   'request-snapshot': Record<string, never>
   'request-history': Record<string, never>
   'start-monitor': Record<string, never>
@@ -122,6 +157,10 @@ interface PerfEvents extends Record<string, unknown> {
   'export-session': Record<string, never>
   'clear-data': Record<string, never>
   'session-data': { snapshots: PerfSnapshot[]; history: FPSHistory }
+  'request-snapshot-range': { maxRows: number }
+  'snapshot-range': { snapshots: PerfSnapshot[] }
+  'raw-frames': { uiTimestampsMs: number[]; uiMissed: number }
+  'stutter-episodes': StutterEpisode[]
   'request-arch-info': Record<string, never>
   'arch-info': ArchInfo
   'request-startup-timing': Record<string, never>
@@ -135,11 +174,18 @@ interface MemoryDataPoint {
   ramMB: number
   heapUsedMB: number
   heapTotalMB: number
+  pssMB: number  // 0 where the platform has no PSS (iOS)
+  swapMB: number
 }
 
 interface StutterEvent {
   timestamp: number
   droppedFrames: number
+  durationMs: number
+  worstFrameMs: number
+  runQueueMs: number  // 0 where the platform has no scheduler stats (iOS)
+  majorFaults: number
+  thread: string
 }
 
 interface FrameTimeEntry {
@@ -159,6 +205,25 @@ interface AlertEntry {
 const MAX_MEMORY_POINTS = 120
 const MAX_FRAME_TIMES = 300
 const MAX_STUTTER_EVENTS = 500
+const MAX_FPS_HISTORY_POINTS = 600
+
+function appendSamples(previous: number[] | undefined, added: number[], reset: boolean): number[] {
+  const merged = reset || !previous ? added : previous.concat(added)
+  return merged.length > MAX_FPS_HISTORY_POINTS
+    ? merged.slice(merged.length - MAX_FPS_HISTORY_POINTS)
+    : merged
+}
+
+function toMemoryDataPoint(snapshot: PerfSnapshot): MemoryDataPoint {
+  return {
+    timestamp: snapshot.timestamp,
+    ramMB: snapshot.ramBytes / (1024 * 1024),
+    heapUsedMB: snapshot.jsHeapUsedBytes / (1024 * 1024),
+    heapTotalMB: snapshot.jsHeapTotalBytes / (1024 * 1024),
+    pssMB: snapshot.pssBytes / (1024 * 1024),
+    swapMB: snapshot.swapBytes / (1024 * 1024),
+  }
+}
 
 const TABS = [
   { id: 'overview', label: 'Overview' },
@@ -192,8 +257,8 @@ export default function Panel() {
   const [aiInsightsEnabled, setAiInsightsEnabled] = useState(false)
   const [componentRenderStats, setComponentRenderStats] = useState<ComponentRenderStats[]>([])
 
-  const prevStutterCount = useRef(0)
-  const prevSnapshotTs = useRef(0)
+  const prevFrameTs = useRef(0)
+  const frameBudgetMs = useRef(16.67)
   const alertIdCounter = useRef(0)
 
   // Compute memory trend (MB/min) from last 30 data points
@@ -296,31 +361,13 @@ export default function Panel() {
         return [...prev, item]
       })
 
-      // Derive frame times from consecutive snapshots
-      if (prevSnapshotTs.current > 0) {
-        const frameTimeMs = snapshot.timestamp - prevSnapshotTs.current
-        if (frameTimeMs > 0 && frameTimeMs < 5000) {
-          setFrameTimes((prev) => {
-            const item = { timestamp: snapshot.timestamp, frameTimeMs, budgetMs: 16.67 }
-            if (prev.length >= MAX_FRAME_TIMES) {
-              const trimmed = prev.slice(1)
-              trimmed.push(item)
-              return trimmed
-            }
-            return [...prev, item]
-          })
-        }
+      if (snapshot.refreshRateHz > 0) {
+        frameBudgetMs.current = 1000 / snapshot.refreshRateHz
       }
-      prevSnapshotTs.current = snapshot.timestamp
 
       // Track memory over time
       setMemoryData((prev) => {
-        const item = {
-          timestamp: snapshot.timestamp,
-          ramMB: snapshot.ramBytes / (1024 * 1024),
-          heapUsedMB: snapshot.jsHeapUsedBytes / (1024 * 1024),
-          heapTotalMB: snapshot.jsHeapTotalBytes / (1024 * 1024),
-        }
+        const item = toMemoryDataPoint(snapshot)
         if (prev.length >= MAX_MEMORY_POINTS) {
           const trimmed = prev.slice(1)
           trimmed.push(item)
@@ -329,20 +376,6 @@ export default function Panel() {
         return [...prev, item]
       })
 
-      // Track stutter events (capped)
-      if (snapshot.stutterCount > prevStutterCount.current) {
-        setStutterEvents((prev) => {
-          const item = { timestamp: snapshot.timestamp, droppedFrames: snapshot.droppedFrames }
-          if (prev.length >= MAX_STUTTER_EVENTS) {
-            const trimmed = prev.slice(1)
-            trimmed.push(item)
-            return trimmed
-          }
-          return [...prev, item]
-        })
-      }
-      prevStutterCount.current = snapshot.stutterCount
-
       // Check alert thresholds
       checkAlerts(snapshot)
     })
@@ -351,6 +384,61 @@ export default function Panel() {
       setHistory(h)
     })
 
+    plugin.onMessage('perf-history-delta', (delta: FPSHistoryDelta) => {
+      setHistory((prev) => ({
+        uiFpsSamples: appendSamples(prev?.uiFpsSamples, delta.uiFpsSamples, delta.uiReset),
+        jsFpsSamples: appendSamples(prev?.jsFpsSamples, delta.jsFpsSamples, delta.jsReset),
+        uiFpsMin: delta.uiFpsMin,
+        uiFpsMax: delta.uiFpsMax,
+        jsFpsMin: delta.jsFpsMin,
+        jsFpsMax: delta.jsFpsMax,
+      }))
+    })
+
+    // Real per-frame times from the UI thread's raw frame timestamps
+    plugin.onMessage('raw-frames', ({ uiTimestampsMs, uiMissed }) => {
+      if (uiMissed > 0) prevFrameTs.current = 0
+      const items: FrameTimeEntry[] = []
+      for (const ts of uiTimestampsMs) {
+        const frameTimeMs = ts - prevFrameTs.current
+        // Skip the first frame and pauses (backgrounded, monitor stopped)
+        if (prevFrameTs.current > 0 && frameTimeMs > 0 && frameTimeMs < 2000) {
+          items.push({ timestamp: ts, frameTimeMs, budgetMs: frameBudgetMs.current })
+        }
+        prevFrameTs.current = ts
+      }
+      if (items.length === 0) return
+      setFrameTimes((prev) => {
+        const merged = prev.concat(items)
+        return merged.length > MAX_FRAME_TIMES ? merged.slice(merged.length - MAX_FRAME_TIMES) : merged
+      })
+    })
+
+    // Stutter events (capped), one per native episode
+    plugin.onMessage('stutter-episodes', (episodes: StutterEpisode[]) => {
+      const items = episodes.map((e) => ({
+        timestamp: e.startMs,
+        droppedFrames: e.framesSkipped,
+        durationMs: e.durationMs,
+        worstFrameMs: e.worstFrameMs,
+        runQueueMs: e.runQueueMs,
+        majorFaults: e.majorFaults,
+        thread: e.thread,
+      }))
+      setStutterEvents((prev) => {
+        const merged = prev.concat(items)
+        return merged.length > MAX_STUTTER_EVENTS ? merged.slice(merged.length - MAX_STUTTER_EVENTS) : merged
+      })
+    })
+
+    // Backfill charts from the app's retained snapshots after a panel reload
+    plugin.onMessage('snapshot-range', ({ snapshots }) => {
+      if (snapshots.length === 0) return
+      setMetrics((prev) => prev ?? snapshots[snapshots.length - 1]!)
+      setFpsData(snapshots.map((s) => ({ uiFps: s.uiFps, jsFps: s.jsFps })))
+      setMemoryData(snapshots.map(toMemoryDataPoint))
+    })
+
     plugin.onMessage('arch-info', (info: ArchInfo) => {
       setArchInfo(info)
     })
@@ -367,9 +455,10 @@ export default function Panel() {
       setComponentRenderStats(stats)
     })
 
-    // Request arch info and startup timing on connect
+    // Request arch info, startup timing and retained snapshots on connect
     plugin.send('request-arch-info', {} as Record<string, never>)
     plugin.send('request-startup-timing', {} as Record<string, never>)
+    plugin.send('request-snapshot-range', { maxRows: MAX_MEMORY_POINTS })
   }, [plugin, checkAlerts])
 
   const handleStart = useCallback(() => {
@@ -392,8 +481,7 @@ export default function Panel() {
     setAlerts([])
     setFpsData([])
     setComponentRenderStats([])
-    prevStutterCount.current = 0
-    prevSnapshotTs.current = 0
+    prevFrameTs.current = 0
   }, [plugin])
 
   const handleClearAlerts = useCallback(() => {
@@ -409,8 +497,7 @@ export default function Panel() {
     setAlerts([])
     setFpsData([])
     setComponentRenderStats([])
-    prevStutterCount.current = 0
-    prevSnapshotTs.current = 0
+    prevFrameTs.current = 0
   }, [plugin])
 
   return (
@@ -874,7 +961,12 @@ export default function Panel() {
                     <tr style={{ borderBottom: '1px solid #333' }}>
                       <th style={thStyle}>#</th>
                       <th style={thStyle}>Time</th>
+                      <th style={thStyle}>Thread</th>
+                      <th style={thStyle}>Duration</th>
                       <th style={thStyle}>Dropped Frames</th>
+                      <th style={thStyle}>Worst Frame</th>
+                      <th style={thStyle}>Run Queue</th>
+                      <th style={thStyle}>Major Faults</th>
                       <th style={thStyle}>Severity</th>
                     </tr>
                   </thead>
@@ -886,7 +978,12 @@ export default function Panel() {
                         <tr key={i} style={{ borderBottom: '1px solid #2a2a2a' }}>
                           <td style={tdStyle}>{stutterEvents.length - i}</td>
                           <td style={tdStyle}>{new Date(event.timestamp).toLocaleTimeString()}</td>
+                          <td style={tdStyle}>{event.thread.toUpperCase()}</td>
+                          <td style={tdStyle}>{event.durationMs.toFixed(0)} ms</td>
                           <td style={tdStyle}>{event.droppedFrames}</td>
+                          <td style={tdStyle}>{event.worstFrameMs.toFixed(1)} ms</td>
+                          <td style={tdStyle}>{event.runQueueMs.toFixed(1)} ms</td>
+                          <td style={tdStyle}>{event.majorFaults}</td>
                           <td style={{ ...tdStyle, color, fontWeight: 600 }}>{severity}</td>
                         </tr>
                       )
@@ -15,6 +15,8 @@ interface MemoryDataPoint {
   ramMB: number
   heapUsedMB: number
   heapTotalMB: number
+  pssMB: number
+  swapMB: number
 }
 
 export function MemoryChart({
@@ -28,9 +30,16 @@ export function MemoryChart({
       ramMB: parseFloat(point.ramMB.toFixed(1)),
       heapUsedMB: parseFloat(point.heapUsedMB.toFixed(1)),
       heapTotalMB: parseFloat(point.heapTotalMB.toFixed(1)),
+      pssMB: parseFloat(point.pssMB.toFixed(1)),
+      swapMB: parseFloat(point.swapMB.toFixed(1)),
     }))
   }, [dataPoints])
 
+  // The breakdown is sampled every few seconds and only where the
+  // platform reports it; hide series that never had a value
+  const hasPss = dataPoints.some((point) => point.pssMB > 0)
+  const hasSwap = dataPoints.some((point) => point.swapMB > 0)
+
   return (
     <div style={{ background: '#1e1e1e', borderRadius: 8, padding: 16 }}>
       <div style={{ color: '#fff', fontSize: 14, fontWeight: 600, marginBottom: 12 }}>
@@ -84,6 +93,30 @@ export function MemoryChart({
             name="JS Heap Total"
             isAnimationActive={false}
           />
+          {hasPss && (
+            <Area
+              type="stepAfter"
+              dataKey="pssMB"
+              stroke="#FFC107"
+              fill="none"
+              strokeWidth={2}
+              strokeDasharray="6 3"
+              name="PSS"
+              isAnimationActive={false}
+            />
+          )}
+          {hasSwap && (
+            <Area
+              type="stepAfter"
+              dataKey="swapMB"
+              stroke="#F44336"
+              fill="none"
+              strokeWidth={2}
+              strokeDasharray="6 3"
+              name="Swap"
+              isAnimationActive={false}
+            />
+          )}
         </AreaChart>
       </ResponsiveContainer>
     </div>